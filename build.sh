@@ -75,12 +75,12 @@ cmd_buildrun() {
 	display_styled_symbol 3 "⬤" "Build & Run: $BUILD (target: $NAME)"
 	echo
 	BLD=$BUILD
-	if [[ $BUILD == 'Tests' && $1 != 'main' ]]; then
+	if [[ ($BUILD == 'Tests' || $BUILD == 'Headless') && $1 != 'main' ]]; then
 		BLD=Release
 	fi
 	if $MAKE_EXEC BUILD=$BLD; then
 		build_success_launch
-		if [[ $BUILD == 'Tests' ]]; then
+		if [[ $BUILD == 'Tests' || $BUILD == 'Headless' ]]; then
 			bin/Release/$NAME $OPTIONS
 		else
 			bin/$BUILD/$NAME $OPTIONS
@@ -94,7 +94,7 @@ cmd_build() {
 	display_styled_symbol 3 "⬤" "Build: $BUILD (target: $NAME)"
 	echo
 	BLD=$BUILD
-	if [[ $BUILD == 'Tests' && $1 != 'main' ]]; then
+	if [[ ($BUILD == 'Tests' || $BUILD == 'Headless') && $1 != 'main' ]]; then
 		BLD=Release
 	fi
 	if $MAKE_EXEC BUILD=$BLD; then
@@ -108,7 +108,7 @@ cmd_rebuild() {
 	display_styled_symbol 3 "⬤" "Rebuild: $BUILD (target: $NAME)"
 	echo
 	BLD=$BUILD
-	if [[ $BUILD == 'Tests' && $1 != 'main' ]]; then
+	if [[ ($BUILD == 'Tests' || $BUILD == 'Headless') && $1 != 'main' ]]; then
 		BLD=Release
 	fi
 	if $MAKE_EXEC BUILD=$BLD rebuild; then
@@ -122,7 +122,7 @@ cmd_run() {
 	display_styled_symbol 3 "⬤" "Run: $BUILD (target: $NAME)"
 	echo
 	launch
-	if [[ $BUILD == 'Tests' ]]; then
+	if [[ $BUILD == 'Tests' || $BUILD == 'Headless' ]]; then
 		bin/Release/$NAME $OPTIONS
 	else
 		bin/$BUILD/$NAME $OPTIONS
@@ -214,7 +214,7 @@ if [[ $PLATFORM == 'windows' ]]; then
 	fi
 fi
 
-if [[ $BUILD != "Release" && $BUILD != 'Debug' && $BUILD != 'Tests' ]]; then
+if [[ $BUILD != "Release" && $BUILD != 'Debug' && $BUILD != 'Tests' && $BUILD != 'Headless' ]]; then
 	BUILD=Release
 fi
 
@@ -235,6 +235,8 @@ for target in $BUILD_TARGETS; do
 			export NAME=$cwd.exe
 			if [[ $BUILD == 'Tests' ]]; then
 				NAME=tests_$NAME
+			elif [[ $BUILD == 'Headless' ]]; then
+				NAME=headless_$NAME
 			fi
 		else
 			if [[ $BUILD == 'Debug' ]]; then
@@ -249,6 +251,8 @@ for target in $BUILD_TARGETS; do
 				export NAME=$cwd
 				if [[ $BUILD == 'Tests' ]]; then
 					NAME=tests_$NAME
+				elif [[ $BUILD == 'Headless' ]]; then
+					NAME=headless_$NAME
 				fi
 			else
 				if [[ $BUILD == 'Debug' ]]; then
@@ -262,6 +266,8 @@ for target in $BUILD_TARGETS; do
 				export NAME=$cwd
 				if [[ $BUILD == 'Tests' ]]; then
 					NAME=tests_$NAME
+				elif [[ $BUILD == 'Headless' ]]; then
+					NAME=headless_$NAME
 				fi
 			else
 				if [[ $BUILD == 'Debug' ]]; then
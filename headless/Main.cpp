@@ -0,0 +1,347 @@
+#include <SFML/Graphics.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/constants.hpp"
+#include "editor/callbacks/my_contact_listener.hpp"
+#include "editor/callbacks/impact_aggregator.hpp"
+#include "editor/callbacks/parallel_query.hpp"
+#include "editor/callbacks/trigger_zone.hpp"
+#include "editor/managers/edge_chain_manager.hpp"
+#include "editor/managers/trigger_zone_manager.hpp"
+#include "editor/managers/sprite_manager.hpp"
+#include "scenario.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Headless simulation runner
+ *
+ * Runs the editor's managers against a b2World with no window, ImGui or
+ * drawing. Steps a fixed number of frames as fast as possible and prints
+ * step time statistics and final body counts.
+ */
+
+using sf::Vector2f;
+using std::cout;
+using std::cerr;
+using std::string;
+using std::vector;
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		unsigned int	frames = 600;
+		Vector2f		levelSize = Vector2f(3456.f, 1620.f);
+		bool			contactListener = false;
+		unsigned int	rays = 0;
+		int				threads = -1;		// -1 uses every hardware thread
+		vector<string>	scenes;
+		vector<string>	spawnLists;
+	};
+
+	void PrintUsage(const char* name)
+	{
+		cout << "Usage: " << name << " [options]\n"
+			"  --frames <n>       Number of fixed steps to run (default 600)\n"
+			"  --scene <file>     Chains and trigger zones (replaces the demo chains)\n"
+			"  --spawn <file>     Scripted spawn and query list\n"
+			"  --level <w> <h>    Level size in pixels (default 3456 1620)\n"
+			"  --listener         Register MyContactListener (counts contact events)\n"
+			"  --rays <n>         Cast n sight-line rays after every step\n"
+			"  --threads <n>      Query threads besides the main one (default: use every hardware thread)\n"
+			"  --help             Show this message\n";
+	}
+
+	bool ParseOptions(int argc, char** argv, Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			string arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if (arg == "--frames" && hasValue)
+				options.frames = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+			else if (arg == "--scene" && hasValue)
+				options.scenes.push_back(argv[++i]);
+			else if (arg == "--spawn" && hasValue)
+				options.spawnLists.push_back(argv[++i]);
+			else if (arg == "--level" && i + 2 < argc)
+			{
+				options.levelSize.x = std::strtof(argv[++i], nullptr);
+				options.levelSize.y = std::strtof(argv[++i], nullptr);
+			}
+			else if (arg == "--listener")
+				options.contactListener = true;
+			else if (arg == "--rays" && hasValue)
+				options.rays = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+			else if (arg == "--threads" && hasValue)
+				options.threads = (int)std::strtol(argv[++i], nullptr, 10);
+			else
+				return false;
+		}
+
+		return true;
+	}
+
+	/* Nearest-rank percentile of a sorted sample set */
+	double Percentile(const vector<double>& sorted, double p)
+	{
+		if (sorted.empty())
+			return 0.0;
+
+		size_t rank = (size_t)std::ceil(p / 100.0 * sorted.size());
+		rank = std::max<size_t>(rank, 1);
+		return sorted[std::min(rank, sorted.size()) - 1];
+	}
+
+	void PrintStats(const string& label, vector<double> samples)
+	{
+		if (samples.empty())
+			return;
+
+		std::sort(samples.begin(), samples.end());
+
+		double total = 0.0;
+		for (double s : samples)
+			total += s;
+
+		cout << std::fixed << std::setprecision(4)
+			 << std::left << std::setw(8) << label << std::right
+			 << " min "  << std::setw(9) << samples.front()
+			 << " mean " << std::setw(9) << total / samples.size()
+			 << " p50 "  << std::setw(9) << Percentile(samples, 50.0)
+			 << " p95 "  << std::setw(9) << Percentile(samples, 95.0)
+			 << " p99 "  << std::setw(9) << Percentile(samples, 99.0)
+			 << " max "  << std::setw(9) << samples.back()
+			 << "  (ms)\n";
+	}
+
+	double ElapsedMs(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+
+	/* Load scene and spawn list */
+	Scenario scenario;
+	string error;
+
+	for (const auto& path : options.scenes)
+	{
+		if (!LoadScenario(path, scenario, error))
+		{
+			cerr << "error: " << error << "\n";
+			return 1;
+		}
+	}
+
+	for (const auto& path : options.spawnLists)
+	{
+		if (!LoadScenario(path, scenario, error))
+		{
+			cerr << "error: " << error << "\n";
+			return 1;
+		}
+	}
+
+	SortScenario(scenario);
+
+	/* No window, so resolution is derived from the level size */
+	EditorSettings::RESOLUTION = options.levelSize * .5f;
+	EditorSettings::levelSize = sf::Vector2u(
+		(unsigned int)options.levelSize.x, (unsigned int)options.levelSize.y);
+
+	/* Deterministic runs */
+	std::srand(0);
+
+	/** Prepare the world */
+	b2Vec2 gravity(0.f, 9.8f);
+	std::unique_ptr<b2World> world(new b2World(gravity));
+
+	MyContactListener contactListener;
+	if (options.contactListener)
+		world->SetContactListener(&contactListener);
+
+	ImpactAggregator impactAggregator;
+
+	// No MyDestructionListener: it prints for every destroyed fixture,
+	// which would land inside the timed loop
+
+	/* Managers */
+	std::unique_ptr<EdgeChainManager> edgeChainManager(new EdgeChainManager(world.get()));
+	std::unique_ptr<SpriteManager> spriteManager(new SpriteManager(world.get()));
+
+	// A scene's chains replace the demo chains
+	if (!scenario.chains.empty())
+	{
+		while (edgeChainManager->GetChainCount() > 0)
+			edgeChainManager->PopChain();
+
+		for (auto& chain : scenario.chains)
+			edgeChainManager->PushChain(chain.vertices, Vector2f(0.f, 0.f));
+	}
+
+	vector<std::unique_ptr<TriggerZone>> zones;
+	TriggerZoneManager triggerZoneManager(world.get());
+
+	for (const auto& zone : scenario.zones)
+	{
+		zones.emplace_back(new TriggerZone(zone.position, zone.size));
+		triggerZoneManager.AddZone(zones.back()->GetAABB());
+	}
+
+	/* Sight lines between the top and bottom of the level, cast in
+	   parallel once the step has finished */
+	WorkerPool workerPool(options.threads < 0 ?
+		WorkerPool::GetDefaultThreadCount() : (size_t)options.threads);
+	ParallelQueryBatch queryBatch;
+	size_t rayHits = 0;
+
+	/** Run */
+	vector<double> stepTimes;
+	vector<double> frameTimes;
+	vector<double> queryTimes;
+	stepTimes.reserve(options.frames);
+	frameTimes.reserve(options.frames);
+	queryTimes.reserve(options.rays > 0 ? options.frames : 0);
+
+	size_t contactEvents = 0;
+	size_t droppedEvents = 0;
+	size_t impacts = 0;
+	size_t impactCues = 0;
+	size_t zoneEnters = 0;
+	size_t zoneExits = 0;
+
+	auto spawn = scenario.spawns.begin();
+	auto query = scenario.queries.begin();
+
+	auto runStart = Clock::now();
+
+	for (unsigned int frame = 0; frame < options.frames; ++frame)
+	{
+		auto frameStart = Clock::now();
+
+		/* Scripted spawns */
+		for (; spawn != scenario.spawns.end() && spawn->frame <= frame; ++spawn)
+		{
+			for (unsigned int i = 0; i < spawn->count; ++i)
+			{
+				spriteManager->PushShape(spawn->type,
+					spawn->position + spawn->offset * (float)i);
+			}
+		}
+
+		/* One fixed step per frame */
+		spriteManager->SaveTransforms();
+
+		contactListener.ClearEvents();
+
+		auto stepStart = Clock::now();
+		world->Step(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+		stepTimes.push_back(ElapsedMs(stepStart));
+
+		spriteManager->Update(1.f);
+
+		/* Contacts buffered during the step */
+		contactEvents += contactListener.GetEvents().size();
+		droppedEvents += contactListener.GetEvents().GetDroppedCount();
+		impactAggregator.Process(contactListener.GetEvents(), (frame + 1) * TIME_STEP);
+		impacts += impactAggregator.GetImpactCount();
+		impactCues += impactAggregator.GetCues().size();
+
+		/* Parallel sight-line queries */
+		if (options.rays > 0)
+		{
+			const float width = options.levelSize.x / SCALE;
+			const float height = options.levelSize.y / SCALE;
+
+			auto queryStart = Clock::now();
+
+			queryBatch.Clear();
+			for (unsigned int i = 0; i < options.rays; ++i)
+			{
+				float t = (i + .5f) / options.rays;
+				queryBatch.AddRay(b2Vec2(t * width, 0.f),
+					b2Vec2((1.f - t) * width, height));
+			}
+
+			queryBatch.Execute(world.get(), workerPool);
+			queryTimes.push_back(ElapsedMs(queryStart));
+			rayHits += queryBatch.GetRayHits().size();
+		}
+
+		/* Trigger zone overlaps */
+		triggerZoneManager.Update();
+		zoneEnters += triggerZoneManager.GetEnterEvents().size();
+		zoneExits += triggerZoneManager.GetExitEvents().size();
+
+		/* Scripted trigger zone queries */
+		for (; query != scenario.queries.end() && *query <= frame; ++query)
+		{
+			for (auto& zone : zones)
+				zone->Query(world.get());
+		}
+
+		frameTimes.push_back(ElapsedMs(frameStart));
+	}
+
+	double runTime = ElapsedMs(runStart);
+
+	/** Report */
+	cout << "frames   " << options.frames << " in "
+		 << std::fixed << std::setprecision(1) << runTime << " ms ("
+		 << (runTime > 0.0 ? options.frames * 1000.0 / runTime : 0.0)
+		 << " steps/s)\n";
+
+	PrintStats("step", stepTimes);
+	PrintStats("frame", frameTimes);
+	PrintStats("query", queryTimes);
+
+	cout << "bodies   " << world->GetBodyCount()
+		 << " (dynamic " << SpriteManager::DynamicBodiesCount
+		 << ": box " << DebugShape::DebugBoxCount
+		 << ", circle " << DebugShape::DebugCircleCount
+		 << ", polygon " << DebugShape::CustomPolygonCount
+		 << ", multi " << DebugShape::MultiShapeCount << ")\n"
+		 << "active   " << spriteManager->GetActiveShapeCount() << "\n"
+		 << "chains   " << edgeChainManager->GetChainCount() << "\n"
+		 << "zones    " << zones.size()
+		 << " (enter " << zoneEnters << ", exit " << zoneExits << ")\n"
+		 << "contacts " << world->GetContactCount() << "\n"
+		 << "proxies  " << world->GetProxyCount() << "\n";
+
+	if (options.rays > 0)
+	{
+		cout << "rays     " << options.rays << " / step on "
+			 << workerPool.GetWorkerCount() << " threads (hits " << rayHits << ")\n";
+	}
+
+	if (options.contactListener)
+	{
+		cout << "events   " << contactEvents
+			 << " (impacts " << impacts << ", cues " << impactCues
+			 << ", dropped " << droppedEvents << ")\n";
+	}
+
+	return 0;
+}
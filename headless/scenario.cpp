@@ -0,0 +1,148 @@
+#include "scenario.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using sf::Vector2f;
+using std::string;
+using std::vector;
+
+namespace
+{
+	bool ParseShapeType(const string& name, ShapeType& type)
+	{
+		if (name == "box")
+			type = ShapeType::DebugBox;
+		else if (name == "circle")
+			type = ShapeType::DebugCircle;
+		else if (name == "polygon")
+			type = ShapeType::CustomPolygon;
+		else if (name == "multi")
+			type = ShapeType::MultiShape;
+		else
+			return false;
+
+		return true;
+	}
+
+	string LineError(const string& path, unsigned int line, const string& what)
+	{
+		return path + ":" + std::to_string(line) + ": " + what;
+	}
+}
+
+bool LoadScenario(const string& path, Scenario& scenario, string& error)
+{
+	std::ifstream file(path);
+
+	if (!file)
+	{
+		error = "cannot open " + path;
+		return false;
+	}
+
+	string line;
+	unsigned int lineNumber = 0;
+
+	while (std::getline(file, line))
+	{
+		++lineNumber;
+
+		// Strip comments
+		auto comment = line.find('#');
+		if (comment != string::npos)
+			line.erase(comment);
+
+		std::istringstream in(line);
+		string directive;
+
+		if (!(in >> directive))
+			continue;
+
+		if (directive == "chain")
+		{
+			ChainDef chain;
+			float x, y;
+
+			while (in >> x >> y)
+				chain.vertices.push_back(Vector2f(x, y));
+
+			if (chain.vertices.size() < 2)
+			{
+				error = LineError(path, lineNumber, "chain needs at least 2 vertices");
+				return false;
+			}
+
+			scenario.chains.push_back(chain);
+		}
+		else if (directive == "zone")
+		{
+			ZoneDef zone;
+
+			if (!(in >> zone.position.x >> zone.position.y
+					 >> zone.size.x >> zone.size.y))
+			{
+				error = LineError(path, lineNumber, "expected: zone x y w h");
+				return false;
+			}
+
+			scenario.zones.push_back(zone);
+		}
+		else if (directive == "spawn")
+		{
+			SpawnEvent spawn;
+			string type;
+
+			if (!(in >> spawn.frame >> type >> spawn.position.x >> spawn.position.y))
+			{
+				error = LineError(path, lineNumber,
+					"expected: spawn frame type x y [count dx dy]");
+				return false;
+			}
+
+			if (!ParseShapeType(type, spawn.type))
+			{
+				error = LineError(path, lineNumber, "unknown shape type '" + type + "'");
+				return false;
+			}
+
+			spawn.count = 1;
+			spawn.offset = Vector2f(0.f, 0.f);
+
+			if (in >> spawn.count)
+				in >> spawn.offset.x >> spawn.offset.y;
+
+			scenario.spawns.push_back(spawn);
+		}
+		else if (directive == "query")
+		{
+			unsigned int frame;
+
+			if (!(in >> frame))
+			{
+				error = LineError(path, lineNumber, "expected: query frame");
+				return false;
+			}
+
+			scenario.queries.push_back(frame);
+		}
+		else
+		{
+			error = LineError(path, lineNumber, "unknown directive '" + directive + "'");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void SortScenario(Scenario& scenario)
+{
+	std::stable_sort(scenario.spawns.begin(), scenario.spawns.end(),
+		[](const SpawnEvent& a, const SpawnEvent& b)
+		{
+			return a.frame < b.frame;
+		});
+
+	std::sort(scenario.queries.begin(), scenario.queries.end());
+}
\ No newline at end of file
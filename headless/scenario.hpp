@@ -0,0 +1,60 @@
+#ifndef HEADLESS_SCENARIO_HPP
+#define HEADLESS_SCENARIO_HPP
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include "editor/managers/sprite_manager.hpp"
+
+/** Scenario
+ *
+ * A scene (edge chains and trigger zones) plus a scripted spawn list for
+ * the headless runner. Scenario files are plain text, one directive per
+ * line, with '#' starting a comment:
+ *
+ *   chain <x> <y> <x> <y> ...                  static edge chain (pixels)
+ *   zone  <x> <y> <w> <h>                      trigger zone
+ *   spawn <frame> <type> <x> <y> [n dx dy]     spawn n shapes, offset by dx/dy
+ *   query <frame>                              query all trigger zones
+ *
+ * Shape types are box, circle, polygon and multi.
+ */
+
+struct ChainDef
+{
+	std::vector<sf::Vector2f> vertices;
+};
+
+struct ZoneDef
+{
+	sf::Vector2f position;
+	sf::Vector2f size;
+};
+
+struct SpawnEvent
+{
+	unsigned int frame;
+	ShapeType	 type;
+	sf::Vector2f position;
+	unsigned int count;
+	sf::Vector2f offset;
+};
+
+struct Scenario
+{
+	std::vector<ChainDef>	  chains;
+	std::vector<ZoneDef>	  zones;
+	std::vector<SpawnEvent>	  spawns;		// sorted by frame
+	std::vector<unsigned int> queries;		// sorted frame numbers
+};
+
+/** Parse a scenario file and append its directives to scenario.
+ *  Returns false and fills error when the file can't be read or parsed.
+ */
+bool LoadScenario(const std::string& path, Scenario& scenario,
+	std::string& error);
+
+/** Sort spawn and query events by frame after all files are loaded. */
+void SortScenario(Scenario& scenario);
+
+#endif
\ No newline at end of file
@@ -2,7 +2,7 @@
 #define CAMERA_HPP
 
 #include <SFML/Graphics.hpp>
-#include "editor/animation/tween.hpp"
+#include "editor/managers/tween_manager.hpp"
 
 class Camera {
 private:
@@ -12,31 +12,36 @@ private:
 	sf::Vector2f	m_position;
 
 	sf::Vector2u    m_backgroundSize;
+	sf::Vector2f	m_resolution;
+	float			m_zoom;
 	float 			m_minX;
 	float 			m_minY;
 	float			m_maxX;
 	float			m_maxY;
 	bool			m_clampToBackground;
 
-	/** Data for tween animation
+	/** Data for tween animation. The tweens themselves are owned
+	* and updated by the TweenManager.
 	*/
 	InterpFunc 		m_interpolation;
 	float      		m_duration;
-	Tween*			m_tweenX;
-	Tween*			m_tweenY;
-	bool 			m_tweenXActive;
-	bool 			m_tweenYActive;
+	TweenHandle		m_tweenX;
+	TweenHandle		m_tweenY;
 
 private:
 	void InitDefault();
 	void ClampPosition(const sf::Vector2f& pos);
 	void CalculateMinMaxPos(
 		const sf::Vector2u& backgroundSize, const sf::Vector2f& resolution);
+	void CalculateMinMaxPos();
 
 	void SpawnTweenX(float targetX);
 	void SpawnTweenY(float targetY);
 
 public:
+	static constexpr float MIN_ZOOM = .25f;
+	static constexpr float MAX_ZOOM = 4.f;
+
 	/** Initialises a camera with default values.
 	*
 	* Disables clamping to the background size and provides
@@ -55,7 +60,7 @@ public:
 		   const sf::Vector2f& resolution,
 		   bool  clamp /*=true*/ );
 
-	/** Deallocates camera's tween objects.
+	/** Stops the camera's tweens.
 	*/
 	~Camera();
 
@@ -83,6 +88,12 @@ public:
 	float GetDuration() const;
 	void SetDuration(float duration);
 
+	/** Zoom is the visible area relative to the resolution, so
+	* values above 1 zoom out. Clamping limits follow the zoom.
+	*/
+	float GetZoom() const;
+	void SetZoom(float zoom);
+
 	bool ClampEnabled() const;
 	void ClampEnabled(bool flag);
 };
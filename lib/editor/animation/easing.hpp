@@ -0,0 +1,214 @@
+#ifndef EASING_HPP
+#define EASING_HPP
+
+#include "editor/animation/tween.hpp"
+#include <cmath>
+#include <cstddef>
+
+/**
+Normalised easing curves, one specialisation per InterpFunc. Each takes
+a progress value between 0 and 1 and returns the eased progress.
+
+Polynomial curves are written as plain multiplications and are
+constexpr. Curves that need sin, sqrt or exp2 are inline.
+
+Tweens resolve their curve once with GetEaseFunc instead of dispatching
+on the InterpFunc every update.
+*/
+
+template <InterpFunc F>
+float Ease(float t);
+
+// Looks up the specialisation for a runtime InterpFunc
+EaseFunc GetEaseFunc(InterpFunc function);
+
+/** EaseBatch
+ *      InterpFunc - Curve shared by every element
+ *      t, b, c, d - Elapsed time, start value, change and duration arrays
+ *      out        - Receives b + c * ease(t / d) for each element
+ *
+ * 	Evaluates many tweens at once, several lanes at a time with SSE or AVX
+ *  when the build targets them. Polynomial curves are vectorised; the rest
+ *  run the scalar curve per lane. Progress is clamped to [0, 1].
+ */
+
+void EaseBatch(InterpFunc function, const float* t, const float* b,
+	const float* c, const float* d, float* out, std::size_t count);
+
+// Lanes EaseBatch evaluates at once in this build (1 without SIMD)
+int GetEaseBatchLanes();
+
+namespace easing_detail
+{
+	constexpr float PI = 3.14159265358979f;
+
+	constexpr float BACK_C1 = 1.70158f;
+	constexpr float BACK_C2 = BACK_C1 * 1.525f;
+	constexpr float BACK_C3 = BACK_C1 + 1.f;
+
+	constexpr float ELASTIC_C4 = (2.f * PI) / 3.f;
+	constexpr float ELASTIC_C5 = (2.f * PI) / 4.5f;
+
+	constexpr float BounceOut(float t)
+	{
+		constexpr float n1 = 7.5625f;
+		constexpr float d1 = 2.75f;
+
+		return t < 1.f / d1 ? n1 * t * t
+			: t < 2.f / d1 ? n1 * (t - 1.5f / d1) * (t - 1.5f / d1) + .75f
+			: t < 2.5f / d1 ? n1 * (t - 2.25f / d1) * (t - 2.25f / d1) + .9375f
+			: n1 * (t - 2.625f / d1) * (t - 2.625f / d1) + .984375f;
+	}
+}
+
+// linear - no easing, no acceleration
+template <> constexpr float Ease<InterpFunc::Linear>(float t) { return t; }
+
+// quadratic
+template <> constexpr float Ease<InterpFunc::QuadEaseIn>(float t) { return t * t; }
+template <> constexpr float Ease<InterpFunc::QuadEaseOut>(float t) { return t * (2.f - t); }
+template <> constexpr float Ease<InterpFunc::QuadEaseInOut>(float t)
+{
+	return t < .5f ? 2.f * t * t
+		: 1.f - (2.f - 2.f * t) * (2.f - 2.f * t) * .5f;
+}
+
+// cubic
+template <> constexpr float Ease<InterpFunc::CubicEaseIn>(float t) { return t * t * t; }
+template <> constexpr float Ease<InterpFunc::CubicEaseOut>(float t)
+{
+	return 1.f - (1.f - t) * (1.f - t) * (1.f - t);
+}
+template <> constexpr float Ease<InterpFunc::CubicEaseInOut>(float t)
+{
+	return t < .5f ? 4.f * t * t * t
+		: 1.f - (2.f - 2.f * t) * (2.f - 2.f * t) * (2.f - 2.f * t) * .5f;
+}
+
+// quartic
+template <> constexpr float Ease<InterpFunc::QuartEaseIn>(float t) { return t * t * t * t; }
+template <> constexpr float Ease<InterpFunc::QuartEaseOut>(float t)
+{
+	return 1.f - (1.f - t) * (1.f - t) * (1.f - t) * (1.f - t);
+}
+template <> constexpr float Ease<InterpFunc::QuartEaseInOut>(float t)
+{
+	return t < .5f ? 8.f * t * t * t * t
+		: 1.f - (2.f - 2.f * t) * (2.f - 2.f * t) * (2.f - 2.f * t) * (2.f - 2.f * t) * .5f;
+}
+
+// quintic
+template <> constexpr float Ease<InterpFunc::QuintEaseIn>(float t) { return t * t * t * t * t; }
+template <> constexpr float Ease<InterpFunc::QuintEaseOut>(float t)
+{
+	return 1.f - (1.f - t) * (1.f - t) * (1.f - t) * (1.f - t) * (1.f - t);
+}
+template <> constexpr float Ease<InterpFunc::QuintEaseInOut>(float t)
+{
+	return t < .5f ? 16.f * t * t * t * t * t
+		: 1.f - (2.f - 2.f * t) * (2.f - 2.f * t) * (2.f - 2.f * t)
+			* (2.f - 2.f * t) * (2.f - 2.f * t) * .5f;
+}
+
+// sinusoidal
+template <> inline float Ease<InterpFunc::SineEaseIn>(float t)
+{
+	return 1.f - std::cos(t * easing_detail::PI * .5f);
+}
+template <> inline float Ease<InterpFunc::SineEaseOut>(float t)
+{
+	return std::sin(t * easing_detail::PI * .5f);
+}
+template <> inline float Ease<InterpFunc::SineEaseInOut>(float t)
+{
+	return (1.f - std::cos(t * easing_detail::PI)) * .5f;
+}
+
+// exponential
+template <> inline float Ease<InterpFunc::ExpoEaseIn>(float t)
+{
+	return t <= 0.f ? 0.f : std::exp2(10.f * t - 10.f);
+}
+template <> inline float Ease<InterpFunc::ExpoEaseOut>(float t)
+{
+	return t >= 1.f ? 1.f : 1.f - std::exp2(-10.f * t);
+}
+template <> inline float Ease<InterpFunc::ExpoEaseInOut>(float t)
+{
+	return t <= 0.f ? 0.f
+		: t >= 1.f ? 1.f
+		: t < .5f ? std::exp2(20.f * t - 10.f) * .5f
+		: (2.f - std::exp2(10.f - 20.f * t)) * .5f;
+}
+
+// circular
+template <> inline float Ease<InterpFunc::CircEaseIn>(float t)
+{
+	return 1.f - std::sqrt(1.f - t * t);
+}
+template <> inline float Ease<InterpFunc::CircEaseOut>(float t)
+{
+	return std::sqrt(1.f - (t - 1.f) * (t - 1.f));
+}
+template <> inline float Ease<InterpFunc::CircEaseInOut>(float t)
+{
+	return t < .5f ? (1.f - std::sqrt(1.f - 4.f * t * t)) * .5f
+		: (std::sqrt(1.f - (2.f - 2.f * t) * (2.f - 2.f * t)) + 1.f) * .5f;
+}
+
+// back - pulls back and/or over throws
+template <> constexpr float Ease<InterpFunc::BackEaseIn>(float t)
+{
+	return easing_detail::BACK_C3 * t * t * t - easing_detail::BACK_C1 * t * t;
+}
+template <> constexpr float Ease<InterpFunc::BackEaseOut>(float t)
+{
+	return 1.f + easing_detail::BACK_C3 * (t - 1.f) * (t - 1.f) * (t - 1.f)
+		+ easing_detail::BACK_C1 * (t - 1.f) * (t - 1.f);
+}
+template <> constexpr float Ease<InterpFunc::BackEaseInOut>(float t)
+{
+	return t < .5f
+		? (4.f * t * t * ((easing_detail::BACK_C2 + 1.f) * 2.f * t - easing_detail::BACK_C2)) * .5f
+		: ((2.f * t - 2.f) * (2.f * t - 2.f)
+			* ((easing_detail::BACK_C2 + 1.f) * (2.f * t - 2.f) + easing_detail::BACK_C2) + 2.f) * .5f;
+}
+
+// elastic
+template <> inline float Ease<InterpFunc::ElasticEaseIn>(float t)
+{
+	return t <= 0.f ? 0.f
+		: t >= 1.f ? 1.f
+		: -std::exp2(10.f * t - 10.f) * std::sin((t * 10.f - 10.75f) * easing_detail::ELASTIC_C4);
+}
+template <> inline float Ease<InterpFunc::ElasticEaseOut>(float t)
+{
+	return t <= 0.f ? 0.f
+		: t >= 1.f ? 1.f
+		: std::exp2(-10.f * t) * std::sin((t * 10.f - .75f) * easing_detail::ELASTIC_C4) + 1.f;
+}
+template <> inline float Ease<InterpFunc::ElasticEaseInOut>(float t)
+{
+	return t <= 0.f ? 0.f
+		: t >= 1.f ? 1.f
+		: t < .5f
+			? -(std::exp2(20.f * t - 10.f) * std::sin((20.f * t - 11.125f) * easing_detail::ELASTIC_C5)) * .5f
+			: (std::exp2(10.f - 20.f * t) * std::sin((20.f * t - 11.125f) * easing_detail::ELASTIC_C5)) * .5f + 1.f;
+}
+
+// bounce
+template <> constexpr float Ease<InterpFunc::BounceEaseIn>(float t)
+{
+	return 1.f - easing_detail::BounceOut(1.f - t);
+}
+template <> constexpr float Ease<InterpFunc::BounceEaseOut>(float t)
+{
+	return easing_detail::BounceOut(t);
+}
+template <> constexpr float Ease<InterpFunc::BounceEaseInOut>(float t)
+{
+	return t < .5f ? (1.f - easing_detail::BounceOut(1.f - 2.f * t)) * .5f
+		: (1.f + easing_detail::BounceOut(2.f * t - 1.f)) * .5f;
+}
+
+#endif
\ No newline at end of file
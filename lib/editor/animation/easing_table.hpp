@@ -0,0 +1,42 @@
+#ifndef EASING_TABLE_HPP
+#define EASING_TABLE_HPP
+
+#include "editor/animation/tween.hpp"
+#include <cstddef>
+#include <vector>
+
+/** EasingTable
+ * An easing curve sampled at evenly spaced points and evaluated by linear
+ * interpolation between them. Trades a little accuracy and (resolution + 1)
+ * floats of memory for no sin, pow or branching per evaluation.
+ *
+ * Worst case absolute error at the default resolution is below 0.01, except
+ * for the circular curves whose infinite slope at the ends costs up to 0.03.
+ */
+
+class EasingTable
+{
+private:
+	InterpFunc			m_function;
+	std::vector<float>	m_samples;
+	float				m_scale;		// samples per unit of progress
+
+public:
+	static constexpr std::size_t DEFAULT_RESOLUTION = 256;
+	static constexpr std::size_t MIN_RESOLUTION = 2;
+
+	EasingTable(InterpFunc function, std::size_t resolution = DEFAULT_RESOLUTION);
+
+	// Eased progress for a progress value, clamped to [0, 1]
+	float Evaluate(float t) const;
+
+	// Same contract as EaseBatch: out = b + c * ease(t / d)
+	void EvaluateBatch(const float* t, const float* b, const float* c,
+		const float* d, float* out, std::size_t count) const;
+
+	InterpFunc  GetFunction() const;
+	std::size_t GetResolution() const;
+	std::size_t GetMemoryUsage() const;
+};
+
+#endif
\ No newline at end of file
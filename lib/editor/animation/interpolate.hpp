@@ -2,6 +2,7 @@
 #define INTERPOLATE_HPP
 
 #include <cmath>
+#include "editor/animation/tween.hpp"
 
 /**
 Interpolation functions implemented for all the standard easing
@@ -20,6 +21,10 @@ public:
 	Interpolate(const Interpolate&) = delete;
 	Interpolate& operator= (const Interpolate&) = delete;
 
+	// evaluates any easing function by value, dispatching on every call.
+	// Prefer resolving a curve once with GetEaseFunc (easing.hpp).
+	static float Evaluate(InterpFunc function, float t, float b, float c, float d);
+
 	// linear - no easing, no acceleration
 	static float Linear(float t, float b, float c, float d);
 
@@ -45,11 +45,15 @@ enum class InterpFunc {
 	BounceEaseInOut = 30
 };
 
+// Normalised easing curve, maps progress in [0, 1] to eased progress
+using EaseFunc = float (*)(float);
+
 class Tween {
 	// Reference to the property being animated
 	float* m_property;
 
 	InterpFunc m_function;
+	EaseFunc   m_ease;		// curve resolved from m_function
 
     float m_startValue;
     float m_targetValue;
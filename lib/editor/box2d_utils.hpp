@@ -59,18 +59,6 @@ void DoTestPoint(b2Fixture* fixture, const Vector2f& clickPos,
 void DoTestPoint(b2Fixture* fixture, const Vector2f& clickPos,
 		CircleShape& sprite);
 
-/** DoRayCast
- *      b2Fixture*        - The shape to test against
- *      sf::Vector2f&     - The ray's end point
- *      sf::RenderWindow& - The window to draw collision points
- *
- * 	Cast a ray from the bottom left hand corner of the window to the passed
- *  end point. Draw the first point of contact on the passed fixture.
- */
-
-void DoRayCast(b2Fixture* fixture, Vector2f& rayEndPoint,
-	RenderWindow& window);
-
 /** CreateCustomPolygon
  *
  * 	Create a CustomPolygon object and add to vector.
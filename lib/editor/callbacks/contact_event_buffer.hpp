@@ -0,0 +1,82 @@
+#ifndef CONTACT_EVENT_BUFFER_HPP
+#define CONTACT_EVENT_BUFFER_HPP
+
+#include "box2d/box2d.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class ContactEventType : std::uint8_t
+{
+	Begin,		// fixtures started touching
+	End,		// fixtures stopped touching
+	Impact		// new contact point arriving faster than the impact speed
+};
+
+/** ContactEvent
+ * Plain record of a contact, written during the step and read after it.
+ * Owners are the packed BodyUserData of each body (0 if the body has no
+ * owner). A packed owner names the same shape for the shape's lifetime and
+ * goes stale once it is removed, so events can be read after the world is
+ * modified without holding b2Body pointers.
+ */
+struct ContactEvent
+{
+	std::uintptr_t		ownerA;
+	std::uintptr_t		ownerB;
+	b2Vec2				point;			// first contact point in world units (impacts only)
+	b2Vec2				normal;			// from A to B (impacts only)
+	float				approachSpeed;	// m/s along the normal (impacts only)
+	float				normalImpulse;	// largest normal impulse, set by PostSolve
+	ContactEventType	type;
+};
+
+/** ContactEventBuffer
+ *
+ * Fixed capacity event list filled by the contact listener during
+ * b2World::Step. Nothing is allocated after construction: Clear() resets
+ * the count, and events past the capacity are counted as dropped.
+ *
+ * Impacts are also indexed by contact so PostSolve can add the solver
+ * impulse to the event PreSolve recorded.
+ */
+class ContactEventBuffer
+{
+private:
+	struct LookupEntry
+	{
+		const b2Contact*	contact;
+		std::uint32_t		event;
+		std::uint32_t		stamp;		// entry is live when it matches m_stamp
+	};
+
+	std::vector<ContactEvent>	m_events;
+	std::size_t					m_count;
+	std::size_t					m_dropped;
+
+	std::vector<LookupEntry>	m_lookup;	// open addressing, power of two size
+	std::uint32_t				m_stamp;
+
+	std::size_t Hash(const b2Contact* contact) const;
+
+public:
+	static constexpr std::size_t DEFAULT_CAPACITY = 8192;
+
+	explicit ContactEventBuffer(std::size_t capacity = DEFAULT_CAPACITY);
+
+	void Clear();
+
+	// Returns the new event, or nullptr if the buffer is full
+	ContactEvent* Push(ContactEventType type, b2Contact* contact);
+	ContactEvent* FindImpact(const b2Contact* contact);
+
+	const ContactEvent* begin() const;
+	const ContactEvent* end() const;
+	std::size_t size() const;
+	bool empty() const;
+
+	std::size_t GetCapacity() const;
+	std::size_t GetDroppedCount() const;
+};
+
+#endif
\ No newline at end of file
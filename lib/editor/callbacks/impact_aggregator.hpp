@@ -0,0 +1,88 @@
+#ifndef IMPACT_AGGREGATOR_HPP
+#define IMPACT_AGGREGATOR_HPP
+
+#include "editor/callbacks/contact_event_buffer.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/** ImpactCue
+ * One aggregated impact, ready for a sound or effect. Impacts merged into
+ * the cue only add to its count.
+ */
+struct ImpactCue
+{
+	b2Vec2			point;			// world units
+	float			energy;
+	float			approachSpeed;
+	std::uintptr_t	ownerA;
+	std::uintptr_t	ownerB;
+	int				count;			// impacts represented by this cue
+};
+
+struct ImpactAggregatorSettings
+{
+	float		cellSize = 1.f;			// region size in world units
+	std::size_t	maxPerCell = 2;			// cues kept per region per step
+	std::size_t	maxCues = 16;			// cues kept per step
+	float		cellWindow = .1f;		// seconds a region stays quiet after a cue
+	float		bodyCooldown = .15f;	// seconds a body stays quiet after a cue
+};
+
+/** ImpactAggregator
+ *
+ * Reduces the impacts recorded during a step to at most maxCues cues, so
+ * the audio and effect work downstream is capped however many contacts
+ * the solver produces:
+ *   - impacts are grouped by region (a grid cell) and only the strongest
+ *     maxPerCell of each region become cues, the rest are merged into them
+ *   - a region that produced a cue is skipped for cellWindow seconds
+ *   - a cue whose bodies all produced a cue within bodyCooldown is dropped
+ *   - the strongest maxCues cues are kept
+ */
+class ImpactAggregator
+{
+private:
+	struct Candidate
+	{
+		std::uint64_t	cell;
+		float			energy;
+		const ContactEvent*	event;
+	};
+
+	ImpactAggregatorSettings	m_settings;
+
+	std::vector<Candidate>		m_candidates;	// reused every step
+	std::vector<ImpactCue>		m_cues;
+
+	// Expiry times, pruned every step so they only hold recent cues.
+	// Bodies are keyed by packed owner, which a reused owner slot changes.
+	std::unordered_map<std::uint64_t, float>	m_cellCooldowns;
+	std::unordered_map<std::uintptr_t, float>	m_bodyCooldowns;
+
+	std::size_t					m_impactCount;	// impacts seen by the last Process
+
+	std::uint64_t GetCellKey(const b2Vec2& point) const;
+	bool BodyCoolingDown(std::uintptr_t owner, float time) const;
+	void PruneCooldowns(float time);
+
+public:
+	explicit ImpactAggregator(const ImpactAggregatorSettings& settings = ImpactAggregatorSettings());
+
+	/* time is the simulation time in seconds after the step */
+	void Process(const ContactEventBuffer& events, float time);
+	void Process(const ContactEvent* events, std::size_t count, float time);
+
+	void Reset();
+
+	const std::vector<ImpactCue>& GetCues() const;
+	std::size_t GetImpactCount() const;
+
+	const ImpactAggregatorSettings& GetSettings() const;
+	void SetSettings(const ImpactAggregatorSettings& settings);
+
+	/* Energy of an impact, used to rank impacts and cues */
+	static float GetEnergy(const ContactEvent& event);
+};
+
+#endif
\ No newline at end of file
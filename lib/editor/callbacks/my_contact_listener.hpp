@@ -2,6 +2,7 @@
 #define MY_CONTACT_LISTENER_HPP
 
 #include "box2d/box2d.h"
+#include "editor/callbacks/contact_event_buffer.hpp"
 
 /** b2ContactListener Example
  */
@@ -20,27 +21,33 @@ class MyContactListener : public b2ContactListener
 	 *
 	 * NOTE: Process contact points immediately after time step (some other client
 	 *       code may alter the physics world)
+	 *
+	 * NOTE: Callbacks only append to a preallocated ContactEventBuffer (no I/O,
+	 *       no allocation). Read it with GetEvents() after the step.
 	 */
 
 private:
-	bool m_beginContactOutput = false;
-	bool m_endContactOutput = false;
-	bool m_preSolveOutput = false;
-	bool m_postSolveOutput = false;
+	/* Written during b2World::Step, read by the caller after it returns */
+	ContactEventBuffer m_events;
+
+public:
+	/* Approach speed (m/s) a new contact point needs to count as an impact */
+	static constexpr float IMPACT_SPEED = 1.f;
 
-	void OutputContactInfo(b2Contact* contact, const char* eventType)
+	explicit MyContactListener(std::size_t capacity = ContactEventBuffer::DEFAULT_CAPACITY)
+		: m_events(capacity)
+	{}
+
+	/* Call before each b2World::Step */
+	void ClearEvents()
 	{
-		std::cout << "---------------------------------------------\n"
-			"b2ContactListener::" << eventType << "\n"
-			"  GetFriction()    - " << contact->GetFriction() << "\n"
-			"  GetRestitution() - " << contact->GetRestitution() << "\n"
-			"    FixtureA->GetFriction() - " << contact->GetFixtureA()->GetFriction() << "\n"
-			"    FixtureA->GetDensity()  - " << contact->GetFixtureA()->GetDensity() << "\n"
-			"    FixtureB->GetFriction() - " << contact->GetFixtureB()->GetFriction() << "\n"
-			"    FixtureB->GetDensity()  - " << contact->GetFixtureB()->GetDensity() << "\n\n";
+		m_events.Clear();
 	}
 
-public:
+	const ContactEventBuffer& GetEvents() const
+	{
+		return m_events;
+	}
 
 	/** Beging event
 	 * Called when two fixtures begin to overlap. Called for sensors
@@ -48,8 +55,7 @@ public:
 	 */
 	void BeginContact(b2Contact* contact) override
 	{
-		if (m_beginContactOutput)
-			OutputContactInfo(contact, "BeginContact");
+		m_events.Push(ContactEventType::Begin, contact);
 	}
 
 	/** End event
@@ -58,8 +64,7 @@ public:
 	*/
 	void EndContact(b2Contact* contact) override
 	{
-		if (m_endContactOutput)
-			OutputContactInfo(contact, "EndContact");
+		m_events.Push(ContactEventType::End, contact);
 	}
 
 	/** Pre-solve event
@@ -70,44 +75,43 @@ public:
 	*/
 	void PreSolve(b2Contact* contact, const b2Manifold* oldManifold) override
 	{
-		if (m_preSolveOutput)
-		{
-			OutputContactInfo(contact, "PreSolve");
-		}
-
-		// Get contact point world coordinates
-		b2WorldManifold worldManifold;
-		contact->GetWorldManifold(&worldManifold);
-
 		// Get states of old and current contact points
 		b2PointState state1[2], state2[2];
 		b2GetPointStates(state1, state2, oldManifold, contact->GetManifold());
 
 		// b2_addState - point was added in the update
 		// https://box2d.org/documentation/b2__collision_8h.html#a0a894e3715ce8c61b7958dd6e083663d
-    	if (state2[0] == b2_addState)
-		{
-			const b2Body* bodyA = contact->GetFixtureA()->GetBody();
-        	const b2Body* bodyB = contact->GetFixtureB()->GetBody();
+		if (state2[0] != b2_addState)
+			return;
 
-			// Get first contact point
-        	b2Vec2 point = worldManifold.points[0];
+		// Get contact point world coordinates (only needed for new points)
+		b2WorldManifold worldManifold;
+		contact->GetWorldManifold(&worldManifold);
 
-			// Get velocity vectors from both contact bodies
-			b2Vec2 vA = bodyA->GetLinearVelocityFromWorldPoint(point);
-			b2Vec2 vB = bodyB->GetLinearVelocityFromWorldPoint(point);
+		const b2Body* bodyA = contact->GetFixtureA()->GetBody();
+		const b2Body* bodyB = contact->GetFixtureB()->GetBody();
 
-			// Calculate approach velocity
-			float approachVelocity = b2Dot(vB - vA, worldManifold.normal);
+		// Get first contact point
+		b2Vec2 point = worldManifold.points[0];
 
-			//std::cout << "> approachVelocity: " << approachVelocity << "\n";
+		// Get velocity vectors from both contact bodies
+		b2Vec2 vA = bodyA->GetLinearVelocityFromWorldPoint(point);
+		b2Vec2 vB = bodyB->GetLinearVelocityFromWorldPoint(point);
 
-			// Dot product > 1 means vectors point in same direction
-			// https://www.mathsisfun.com/algebra/vectors-dot-product.html
-			if (approachVelocity > 1.0f)
+		// Calculate approach velocity
+		float approachVelocity = b2Dot(vB - vA, worldManifold.normal);
+
+		// Dot product > 1 means vectors point in same direction
+		// https://www.mathsisfun.com/algebra/vectors-dot-product.html
+		if (approachVelocity > IMPACT_SPEED)
+		{
+			// Sounds are played from the buffer after the step
+			ContactEvent* event = m_events.Push(ContactEventType::Impact, contact);
+			if (event)
 			{
-				/* MyPlayCollisionSound(); */
-				std::cout << "> play collision sound\n";
+				event->point = point;
+				event->normal = worldManifold.normal;
+				event->approachSpeed = approachVelocity;
 			}
 		}
 	}
@@ -118,9 +122,12 @@ public:
 	 */
 	void PostSolve(b2Contact* contact, const b2ContactImpulse* impulse) override
 	{
-		if (m_postSolveOutput)
+		// Attach the solver impulse to an impact recorded this step
+		ContactEvent* event = m_events.FindImpact(contact);
+		if (event)
 		{
-			OutputContactInfo(contact, "PostSolve");
+			for (int i = 0; i < impulse->count; ++i)
+				event->normalImpulse = b2Max(event->normalImpulse, impulse->normalImpulses[i]);
 		}
 
 		contact->SetEnabled(false);
@@ -0,0 +1,116 @@
+#ifndef PARALLEL_QUERY_HPP
+#define PARALLEL_QUERY_HPP
+
+#include "box2d/box2d.h"
+#include "editor/callbacks/ray_query.hpp"
+#include "editor/worker_pool.hpp"
+#include <cstdint>
+#include <vector>
+
+/** ParallelQueryBatch
+ *
+ * Ray casts, AABB queries and point tests run across a WorkerPool against
+ * a world that has finished stepping. b2World::RayCast, QueryAABB and
+ * b2Fixture::TestPoint only read the world, so they are safe to run
+ * concurrently as long as nothing modifies the world until Execute
+ * returns.
+ *
+ * Each worker writes to its own buffers. Afterwards the results are
+ * merged into flat arrays in query order, so the output matches running
+ * the same queries serially:
+ *   rays         GetRayHits()[GetFirstRayHit(i)], GetRayHitCount(i) of them
+ *   AABBs/points GetFixtures()[GetFirstFixture(i)], GetFixtureCount(i) of them
+ * AABB queries and point tests share one index space and fixture array.
+ *
+ * Storage is reused between batches, like RayQueryBatch.
+ */
+class ParallelQueryBatch
+{
+private:
+	enum class ShapeQueryType : std::uint8_t
+	{
+		AABB,
+		Point
+	};
+
+	/* Fixtures overlapping an AABB, optionally containing a point */
+	class FixtureCollector : public b2QueryCallback
+	{
+	public:
+		std::vector<b2Fixture*>*	fixtures = nullptr;
+		const b2Vec2*				point = nullptr;
+		std::uint16_t				maskBits = 0xFFFF;
+
+		bool ReportFixture(b2Fixture* fixture) override;
+	};
+
+	/* Where a query's results sit before the merge */
+	struct LocalResult
+	{
+		std::uint32_t	worker;
+		std::uint32_t	first;
+		std::uint32_t	count;
+	};
+
+	struct alignas(64) WorkerBuffers
+	{
+		std::vector<RayHit>		rayHits;
+		std::vector<b2Fixture*>	fixtures;
+		RayHitCollector			rays;
+		FixtureCollector		shapes;
+	};
+
+	// Rays
+	std::vector<b2Vec2>			m_rayStart;
+	std::vector<b2Vec2>			m_rayEnd;
+	std::vector<RayQueryMode>	m_rayMode;
+	std::vector<std::uint16_t>	m_rayMask;
+
+	// AABB queries and point tests
+	std::vector<b2AABB>			m_shapeAABB;
+	std::vector<b2Vec2>			m_shapePoint;
+	std::vector<ShapeQueryType>	m_shapeType;
+	std::vector<std::uint16_t>	m_shapeMask;
+
+	std::vector<WorkerBuffers>	m_workers;
+	std::vector<LocalResult>	m_rayLocal;
+	std::vector<LocalResult>	m_shapeLocal;
+
+	// Merged results
+	std::vector<std::uint32_t>	m_rayFirst;
+	std::vector<RayHit>			m_rayHits;
+	std::vector<std::uint32_t>	m_shapeFirst;
+	std::vector<b2Fixture*>		m_fixtures;
+
+	void RunQueries(const b2World* world, std::size_t begin, std::size_t end,
+		std::size_t worker);
+	void MergeResults(std::size_t begin, std::size_t end);
+
+public:
+	/* Queries handed to a worker at a time */
+	static constexpr std::size_t QUERY_GRAIN = 64;
+
+	ParallelQueryBatch();
+
+	void Clear();
+
+	/* Points and bounds are in world units (metres) */
+	std::uint32_t AddRay(const b2Vec2& start, const b2Vec2& end,
+		RayQueryMode mode = RayQueryMode::Closest, std::uint16_t maskBits = 0xFFFF);
+	std::uint32_t AddAABBQuery(const b2AABB& aabb, std::uint16_t maskBits = 0xFFFF);
+	std::uint32_t AddPointTest(const b2Vec2& point, std::uint16_t maskBits = 0xFFFF);
+
+	void Execute(const b2World* world, WorkerPool& pool);
+
+	std::size_t GetRayCount() const;
+	std::uint32_t GetFirstRayHit(std::uint32_t ray) const;
+	std::uint32_t GetRayHitCount(std::uint32_t ray) const;
+	const std::vector<RayHit>& GetRayHits() const;
+
+	std::size_t GetShapeQueryCount() const;
+	std::uint32_t GetFirstFixture(std::uint32_t query) const;
+	std::uint32_t GetFixtureCount(std::uint32_t query) const;
+	const std::vector<b2Fixture*>& GetFixtures() const;
+};
+
+#endif
\ No newline at end of file
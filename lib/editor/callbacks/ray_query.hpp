@@ -0,0 +1,107 @@
+#ifndef RAY_QUERY_HPP
+#define RAY_QUERY_HPP
+
+#include "box2d/box2d.h"
+#include <cstdint>
+#include <vector>
+
+enum class RayQueryMode : std::uint8_t
+{
+	Closest,	// nearest hit only
+	Any,		// first hit found, stops the ray straight away
+	All			// nearest MAX_HITS_PER_RAY hits, nearest first
+};
+
+struct RayHit
+{
+	b2Fixture*	fixture;
+	b2Vec2		point;
+	b2Vec2		normal;
+	float		fraction;
+};
+
+/** RayHitCollector
+ *
+ * Casts single rays and appends their hits to a caller owned vector.
+ * Sensor fixtures and fixtures whose category is not in the mask are
+ * ignored. All hits are sorted nearest first. Once a ray has
+ * MAX_HITS_PER_RAY hits, it is clipped to the farthest one, and nearer
+ * hits replace it.
+ */
+class RayHitCollector : public b2RayCastCallback
+{
+private:
+	std::vector<RayHit>*	m_hits;
+	RayQueryMode			m_mode;
+	std::uint16_t			m_maskBits;
+	std::size_t				m_firstHit;		// this ray's first entry in m_hits
+	std::uint32_t			m_hitCount;
+
+	float KeepNearest(const RayHit& hit);
+
+public:
+	static constexpr std::uint32_t MAX_HITS_PER_RAY = 32;
+
+	explicit RayHitCollector(std::vector<RayHit>* hits = nullptr);
+
+	void SetOutput(std::vector<RayHit>* hits);
+
+	/* Returns the number of hits appended */
+	std::uint32_t Cast(const b2World* world, const b2Vec2& start, const b2Vec2& end,
+		RayQueryMode mode, std::uint16_t maskBits);
+
+	float ReportFixture(b2Fixture* fixture, const b2Vec2& point,
+		const b2Vec2& normal, float fraction) override;
+};
+
+/** RayQueryBatch
+ *
+ * Collects rays, runs them through b2World::RayCast and stores every hit
+ * in one flat array. Ray i's hits are GetHits()[GetFirstHit(i)] onwards,
+ * GetHitCount(i) of them.
+ *
+ * Storage is reused between batches: Clear() keeps capacity, so a steady
+ * number of rays per frame does not allocate.
+ */
+class RayQueryBatch
+{
+private:
+	// Rays
+	std::vector<b2Vec2>			m_start;
+	std::vector<b2Vec2>			m_end;
+	std::vector<RayQueryMode>	m_mode;
+	std::vector<std::uint16_t>	m_maskBits;
+
+	// Results
+	std::vector<std::uint32_t>	m_firstHit;
+	std::vector<std::uint32_t>	m_hitCount;
+	std::vector<RayHit>			m_hits;
+
+	// One callback reused for every ray
+	RayHitCollector				m_collector;
+
+public:
+	static constexpr std::uint32_t MAX_HITS_PER_RAY = RayHitCollector::MAX_HITS_PER_RAY;
+
+	RayQueryBatch();
+
+	void Reserve(std::size_t rayCount, std::size_t hitCount);
+	void Clear();
+
+	/* Points are in world units (metres). Returns the ray's index. */
+	std::uint32_t AddRay(const b2Vec2& start, const b2Vec2& end,
+		RayQueryMode mode = RayQueryMode::Closest, std::uint16_t maskBits = 0xFFFF);
+
+	void Execute(const b2World* world);
+
+	std::size_t GetRayCount() const;
+	std::uint32_t GetFirstHit(std::uint32_t ray) const;
+	std::uint32_t GetHitCount(std::uint32_t ray) const;
+
+	/* Nearest hit of a ray, or nullptr if it hit nothing */
+	const RayHit* GetClosestHit(std::uint32_t ray) const;
+
+	const std::vector<RayHit>& GetHits() const;
+};
+
+#endif
\ No newline at end of file
@@ -40,6 +40,7 @@ class TriggerZone : public Draggable
 private:
 	sf::RectangleShape	m_sprite;
 	sf::Color			m_color;
+	bool				m_occupied;
 	sf::Vector2f		m_position;
 	sf::Vector2f		m_size;
 
@@ -71,6 +72,9 @@ public:
 
 	void Query(b2World* world);
 
+	b2AABB GetAABB() const;
+	void SetOccupied(bool occupied);
+
 	void HandleInput(const sf::Event& event);
 	void Update(sf::RenderWindow& window);
 	void Draw(sf::RenderWindow& window);
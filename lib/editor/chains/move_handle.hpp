@@ -11,7 +11,8 @@ private:
 	sf::Vector2f 		m_position;
 
 	sf::Font 			m_font;
-	sf::Text			m_label;
+	mutable sf::Text	m_label;
+	mutable float		m_labelWidth;	// measured on first use
 
 	sf::Color 			m_color;
 	sf::Color 			m_hoverColor;
@@ -25,6 +26,7 @@ private:
 
 private:
 	void Calculate(std::shared_ptr<BoundingBox> boundingBox);
+	void LayoutLabel() const;
 
 public:
 	MoveHandle(std::shared_ptr<BoundingBox> boundingBox, const sf::String& label);
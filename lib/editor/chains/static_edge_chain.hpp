@@ -58,8 +58,6 @@ private:
 	static sf::Vector2f GetNextAddedVertexPosition(
 		std::vector<sf::Vector2f>& vertices);
 
-	void BuildBody(b2World* world);
-
 public:
 	StaticEdgeChain(ChainManagerController* manager);
 	StaticEdgeChain(std::vector<sf::Vector2f>& vertices, const sf::Vector2f& worldPos, const std::string& tag,
@@ -69,6 +67,7 @@ public:
 	void Init(std::vector<sf::Vector2f>& vertices, b2World* world,
 		const sf::Vector2f& worldPos);
 	void DeleteBody(b2World* world);
+	void BuildBody(b2World* world);
 
 	void AddVertex(b2World* world);
 	void RemoveVertex(b2World* world);
@@ -85,6 +84,7 @@ public:
 	void SetTag(const std::string& tag);
 
 	sf::FloatRect GetMoveHandleLabelRect() const;
+	sf::FloatRect GetDrawBounds() const;
 	void DrawBoundingBox(bool flag);
 
 	void SetAddVertexFlag(bool flag);
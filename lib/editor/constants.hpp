@@ -7,6 +7,14 @@ static const float SCALE = 30.f;
 static const float SQUARE_SIZE = 32.f;
 static const float CIRCLE_RADIUS = 18.f;
 
+/* Fixed physics time step */
+static const float TIME_STEP = 1.f / 60.f;
+static const int   VELOCITY_ITERATIONS = 8;
+static const int   POSITION_ITERATIONS = 3;
+
+/* Maximum catch-up steps per rendered frame */
+static const int   MAX_STEPS_PER_FRAME = 5;
+
 enum class RMBMode
 {
 	PanCameraMode = 1,
@@ -0,0 +1,31 @@
+#ifndef CULLING_HPP
+#define CULLING_HPP
+
+#include <SFML/Graphics.hpp>
+#include "box2d/box2d.h"
+
+/** GetViewBounds
+ *      sf::View& - View to get the visible area of
+ *      float     - Margin added to every side
+ *
+ * 	World rectangle covered by an unrotated view, used to skip drawing
+ *  objects that are off screen.
+ */
+
+sf::FloatRect GetViewBounds(const sf::View& view, float margin = 0.f);
+
+/** ToAABB
+ *      sf::FloatRect& - Rectangle in pixels
+ *
+ * 	Converts a pixel rectangle to a Box2D AABB in world units.
+ */
+
+b2AABB ToAABB(const sf::FloatRect& rect);
+
+/** Merge
+ * 	Smallest rectangle containing both rectangles.
+ */
+
+sf::FloatRect Merge(const sf::FloatRect& a, const sf::FloatRect& b);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef BODY_USER_DATA_HPP
+#define BODY_USER_DATA_HPP
+
+#include <box2d/box2d.h>
+#include <cstdint>
+#include "editor/tag_registry.hpp"
+
+enum class ShapeType
+{
+	DebugBox = 1,
+	DebugCircle,
+	CustomPolygon,
+	MultiShape
+};
+
+/** BodyUserData
+ *
+ * Owner of a dynamic b2Body, packed into b2BodyUserData::pointer so it
+ * also fits a 32-bit uintptr_t:
+ *     bits  0-17  slot in the sprite manager's owner table
+ *     bits 18-23  generation of the slot
+ *     bits 24-31  TagId
+ *
+ * An owner slot never moves while its shape lives, so the packed value
+ * stays the same when swap-and-pop removal moves the shape in its array.
+ * Freeing a slot bumps its generation, so a packed owner kept past its
+ * shape's removal no longer resolves. Generations run from 1 and wrap
+ * after MAX_GENERATION reuses of a slot, so a packed owner is never 0 and
+ * bodies without one (edge chains) still read as having no user data.
+ */
+struct BodyUserData
+{
+	TagId			tagId;
+	std::uint32_t	slot;
+	std::uint32_t	generation;
+
+	static constexpr std::uint32_t MAX_SLOT = (1u << 18) - 1;
+	static constexpr std::uint32_t MAX_GENERATION = (1u << 6) - 1;
+
+	b2BodyUserData Pack() const
+	{
+		b2BodyUserData data;
+		data.pointer = static_cast<uintptr_t>(
+			(slot & MAX_SLOT) |
+			(generation & MAX_GENERATION) << 18 |
+			static_cast<std::uint32_t>(tagId) << 24);
+		return data;
+	}
+
+	/* Returns false if the body has no owner */
+	static bool Unpack(const b2BodyUserData& data, BodyUserData& owner)
+	{
+		if (data.pointer == 0)
+			return false;
+
+		std::uint32_t packed = static_cast<std::uint32_t>(data.pointer);
+		owner.slot = packed & MAX_SLOT;
+		owner.generation = (packed >> 18) & MAX_GENERATION;
+		owner.tagId = static_cast<TagId>(packed >> 24);
+		return true;
+	}
+
+	/* Generation a slot takes when it is freed, skipping 0 */
+	static std::uint32_t NextGeneration(std::uint32_t generation)
+	{
+		return generation % MAX_GENERATION + 1;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -3,16 +3,18 @@
 
 #include <SFML/Graphics.hpp>
 #include <box2d/box2d.h>
+#include <array>
 #include <vector>
 #include "editor/debug/debug_shape.hpp"
 #include "editor/constants.hpp"
 
-class CustomPolygon : public DebugShape
+class CustomPolygon final : public DebugShape
 {
 private:
-	std::vector<sf::Vector2f> m_vertices;	// vertex data in world coords
+	// Fixed storage so spawning a polygon doesn't allocate
+	std::array<sf::Vector2f, b2_maxPolygonVertices> m_vertices;		// vertex data in local coords
+	std::array<sf::Vector2f, b2_maxPolygonVertices> m_worldVertices;	// body vertices after Update
 
-	sf::VertexArray 		  m_vertexArray;
 	sf::Color       		  m_color;
 
 	unsigned int 		      m_vertexCount;
@@ -37,6 +39,9 @@ public:
 
 	virtual ~CustomPolygon();
 
+	CustomPolygon(CustomPolygon&& other) noexcept;
+	CustomPolygon& operator= (CustomPolygon&& other) noexcept;
+
 	void CreateBody();
 	void DeleteBody();
 
@@ -45,11 +50,12 @@ public:
 	bool IsWireframe() const;
 	sf::Vector2f GetBodyPosition() const;
 
-	virtual void Update() override;
-	virtual void Draw(sf::RenderWindow& window) override;
+	virtual void SaveTransform() override;
+	virtual bool Update(float alpha) override;
+	virtual void AppendGeometry(ShapeBatch& batch) const override;
+	virtual b2Body* GetBody() const override;
 
-	void DoTestPoint(const sf::Vector2f& point);
-	void ResetTestPoint();
+	virtual void SetHighlighted(bool highlighted) override;
 };
 
 #endif
\ No newline at end of file
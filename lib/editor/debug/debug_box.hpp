@@ -4,11 +4,12 @@
 #include <box2d/box2d.h>
 #include "editor/debug/debug_shape.hpp"
 
-class DebugBox : public DebugShape
+class DebugBox final : public DebugShape
 {
 private:
-	sf::RectangleShape	m_sprite;
 	float 				m_size;
+	float				m_angle;		// radians
+	sf::Color			m_fillColor;
 
 	b2Body*				m_body;
 	b2World*			m_world;
@@ -22,16 +23,19 @@ public:
 	DebugBox(const sf::Vector2f& position, b2World* world);
 	virtual ~DebugBox();
 
+	DebugBox(DebugBox&& other) noexcept;
+	DebugBox& operator= (DebugBox&& other) noexcept;
+
 	void DeleteBody();
 
-	virtual void Update() override;
-	virtual void Draw(sf::RenderWindow& window) override;
+	virtual void SaveTransform() override;
+	virtual bool Update(float alpha) override;
+	virtual void AppendGeometry(ShapeBatch& batch) const override;
+	virtual b2Body* GetBody() const override;
 
-	std::string* GetUserData();
 	sf::Vector2f GetPosition() const;
 
-	void DoTestPoint(const sf::Vector2f& point);
-	void ResetTestPoint();
+	virtual void SetHighlighted(bool highlighted) override;
 
 	// TMP
 	void ApplyForce();
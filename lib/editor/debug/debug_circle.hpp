@@ -6,11 +6,11 @@
 #include "editor/constants.hpp"
 #include "editor/box2d_utils.hpp"
 
-class DebugCircle : public DebugShape
+class DebugCircle final : public DebugShape
 {
 private:
-	sf::CircleShape m_sprite;
 	float 			m_radius;
+	sf::Color		m_fillColor;
 
 	b2Body*			m_body;
 	b2World* 		m_world;
@@ -23,15 +23,18 @@ public:
 		b2World* world);
 
 	virtual ~DebugCircle();
-	void DeleteBody();
 
-	virtual void Update() override;
-	virtual void Draw(sf::RenderWindow& window) override;
+	DebugCircle(DebugCircle&& other) noexcept;
+	DebugCircle& operator= (DebugCircle&& other) noexcept;
+
+	void DeleteBody();
 
-	std::string* GetUserData();
+	virtual void SaveTransform() override;
+	virtual bool Update(float alpha) override;
+	virtual void AppendGeometry(ShapeBatch& batch) const override;
+	virtual b2Body* GetBody() const override;
 
-	void DoTestPoint(const sf::Vector2f& point);
-	void ResetTestPoint();
+	virtual void SetHighlighted(bool highlighted) override;
 };
 
 #endif
\ No newline at end of file
@@ -2,14 +2,46 @@
 #define DEBUG_SHAPE_HPP
 
 #include <SFML/Graphics.hpp>
+#include <box2d/box2d.h>
+#include "editor/debug/body_user_data.hpp"
+#include "editor/debug/shape_batch.hpp"
 
 class DebugShape
 {
 protected:
 	sf::Vector2f	m_position;
-	std::string* 	m_tag;
+	TagId			m_tagId;
+	ShapeType		m_type;
+	std::uint32_t	m_index;			// slot in the sprite manager's array
+	BodyUserData	m_owner;			// stable owner written to the body
 	bool 			m_markedForDelete;
 
+	// Body state before the last physics step (for render interpolation)
+	b2Vec2			m_prevBodyPosition;
+	float			m_prevBodyAngle;
+
+	// Body pose the cached geometry was last built from
+	b2Vec2			m_restPosition;
+	float			m_restAngle;
+	bool			m_geometryAtRest;
+
+protected:
+	void SavePreviousTransform(const b2Body* body);
+	b2Transform GetInterpolatedTransform(const b2Body* body, float alpha,
+		float& angle) const;
+
+	bool IsResting(const b2Body* body) const;
+	void UpdateRestingState(const b2Body* body);
+
+	// Packed owner written to the b2Body's user data. Until the sprite
+	// manager assigns an owner its generation is 0, which never resolves.
+	b2BodyUserData MakeUserData() const;
+
+	// Shapes live by value in the sprite manager's per-type arrays, so
+	// they are movable but never copied (they own a b2Body)
+	DebugShape(DebugShape&& other) noexcept;
+	DebugShape& operator= (DebugShape&& other) noexcept;
+
 public:
 	static unsigned int ShapeBodyCount;
 	static unsigned int DebugBoxCount;
@@ -17,16 +49,40 @@ public:
 	static unsigned int CustomPolygonCount;
 	static unsigned int MultiShapeCount;
 
-	DebugShape(const sf::Vector2f& position, const std::string& tag);
+	DebugShape(const sf::Vector2f& position, const std::string& tag,
+		ShapeType type);
 	virtual ~DebugShape();
 
+	DebugShape(const DebugShape&) = delete;
+	DebugShape& operator= (const DebugShape&) = delete;
+
 	void MarkForDelete(bool flag);
 	bool IsMarkedForDelete() const;
 
 	sf::Vector2f GetPosition() const;
 
-	virtual void Update() = 0;
-	virtual void Draw(sf::RenderWindow& window) = 0;
+	TagId GetTagId() const;
+	const std::string& GetTag() const;
+	ShapeType GetShapeType() const;
+	BodyUserData GetUserData() const;
+
+	// Assigned once by the sprite manager and written to the body
+	const BodyUserData& GetOwner() const;
+	void SetOwner(const BodyUserData& owner);
+
+	// Called by the sprite manager whenever the shape changes slot
+	std::uint32_t GetIndex() const;
+	void SetIndex(std::uint32_t index);
+
+	virtual b2Body* GetBody() const = 0;
+
+	virtual void SaveTransform() = 0;
+	// Returns false if cached geometry was kept for a resting body
+	virtual bool Update(float alpha) = 0;
+	virtual void AppendGeometry(ShapeBatch& batch) const = 0;
+
+	// Colours the shape as picked by the sprite manager's test point
+	virtual void SetHighlighted(bool highlighted) = 0;
 };
 
 #endif
\ No newline at end of file
@@ -3,21 +3,26 @@
 
 #include <SFML/Graphics.hpp>
 #include <box2d/box2d.h>
-#include <vector>
+#include <array>
 #include "editor/debug/debug_shape.hpp"
 #include "editor/constants.hpp"
 
-class MultiShape : public DebugShape
+class MultiShape final : public DebugShape
 {
 private:
 	bool					  m_wireframe;
 	b2Body* 				  m_body;
 	b2World* 				  m_world;
 
-	std::vector<sf::Vector2f> m_shape1;
-	std::vector<sf::Vector2f> m_shape2;
-	sf::VertexArray			  m_va1;
-	sf::VertexArray			  m_va2;
+	// Both fixtures are quads; fixed storage so spawning doesn't allocate
+	using Quad = std::array<sf::Vector2f, 4>;
+
+	Quad					  m_shape1;
+	Quad					  m_shape2;
+	Quad					  m_worldShape1;	// fixture vertices after Update
+	Quad					  m_worldShape2;
+	sf::Color				  m_color1;
+	sf::Color				  m_color2;
 	bool 					  m_multipleFixture;
 
 private:
@@ -29,6 +34,9 @@ public:
 
 	virtual ~MultiShape();
 
+	MultiShape(MultiShape&& other) noexcept;
+	MultiShape& operator= (MultiShape&& other) noexcept;
+
 	void CreateBody();
 	void DeleteBody();
 
@@ -37,11 +45,12 @@ public:
 	bool IsWireframe() const;
 	sf::Vector2f GetBodyPosition() const;
 
-	virtual void Update() override;
-	virtual void Draw(sf::RenderWindow& window) override;
+	virtual void SaveTransform() override;
+	virtual bool Update(float alpha) override;
+	virtual void AppendGeometry(ShapeBatch& batch) const override;
+	virtual b2Body* GetBody() const override;
 
-	void DoTestPoint(const sf::Vector2f& point);
-	void ResetTestPoint();
+	virtual void SetHighlighted(bool highlighted) override;
 };
 
 #endif
\ No newline at end of file
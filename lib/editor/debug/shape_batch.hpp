@@ -0,0 +1,49 @@
+#ifndef SHAPE_BATCH_HPP
+#define SHAPE_BATCH_HPP
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/* Collects debug shape geometry into one vertex buffer per primitive type
+   so every live shape can be drawn with a single draw call per batch.
+   Buffers are cleared, not freed, each frame so their capacity is reused. */
+class ShapeBatch
+{
+private:
+	std::vector<sf::Vertex>		m_triangles;	// filled shapes and outlines
+	std::vector<sf::Vertex>		m_lines;		// wireframe shapes
+
+public:
+	static constexpr std::size_t CIRCLE_POINT_COUNT = 30;
+
+	ShapeBatch();
+
+	void Clear();
+
+	void AddConvexPolygon(const sf::Vector2f* points, std::size_t count,
+		const sf::Color& color);
+
+	void AddOutline(const sf::Vector2f* points, std::size_t count,
+		float thickness, const sf::Color& color);
+
+	void AddLineLoop(const sf::Vector2f* points, std::size_t count,
+		const sf::Color& color);
+
+	void AddLine(const sf::Vector2f& start, const sf::Vector2f& end,
+		const sf::Color& color);
+
+	void AddBox(const sf::Vector2f& center, float size, float angle,
+		const sf::Color& fillColor, float outlineThickness,
+		const sf::Color& outlineColor);
+
+	void AddCircle(const sf::Vector2f& center, float radius,
+		const sf::Color& fillColor, float outlineThickness,
+		const sf::Color& outlineColor);
+
+	void Draw(sf::RenderTarget& target) const;
+
+	std::size_t GetTriangleVertexCount() const;
+	std::size_t GetLineVertexCount() const;
+};
+
+#endif
\ No newline at end of file
@@ -2,6 +2,9 @@
 #define GRID_HPP
 
 #include <SFML/Graphics.hpp>
+#include <map>
+#include <utility>
+#include <vector>
 #include "editor/font_store.hpp"
 
 enum class GridType
@@ -10,13 +13,44 @@ enum class GridType
 	CROSS_HAIR
 };
 
+/* A square block of grid lines, built once and reused while it stays
+   near the camera view. Major line vertices are stored first. */
+struct GridTile
+{
+	std::vector<sf::Vertex>	vertices;
+	std::size_t				majorCount;	// vertices belonging to major lines
+	unsigned int			lastUsed;	// frame the tile was last needed
+};
+
+/* Tile coordinate at a detail level. Coarser levels space their lines
+   further apart, so their tiles cover more of the level. */
+struct GridTileKey
+{
+	int level;
+	int x;
+	int y;
+
+	bool operator<(const GridTileKey& other) const
+	{
+		if (level != other.level) return level < other.level;
+		if (x != other.x) return x < other.x;
+		return y < other.y;
+	}
+};
+
 class Grid
 {
 private:
+	using TileKey = GridTileKey;
+
 	sf::Vector2f		m_resolution;
 	sf::Vector2f 		m_levelSize;
 	sf::Color 			m_color;
-	sf::VertexArray		m_vertexArray;
+
+	// Tiles are generated on demand around the view and evicted once
+	// the cache is full and they haven't been needed for a while
+	std::map<TileKey, GridTile>	m_tiles;
+	unsigned int		m_frame;
 
 	GridType 			m_type;
 	float 				m_unitSize;
@@ -30,15 +64,35 @@ private:
 	static constexpr float MIN_UNIT_SIZE = 10.f;
 	static constexpr float MAX_UNIT_SIZE = 250.f;
 
+	static constexpr int   TILE_UNITS = 32;				// grid units per tile side
+	static constexpr float VIEW_MARGIN = 256.f;			// tiles built ahead of panning
+	static constexpr std::size_t MAX_CACHED_TILES = 128;
+
+	/* Level of detail. Each level spaces lines MAJOR_LINE_EVERY times
+	   further apart than the last, and the finest level whose lines are
+	   at least MIN_LINE_SPACING pixels apart on screen is drawn. */
+	static constexpr int   MAJOR_LINE_EVERY = 5;
+	static constexpr float MIN_LINE_SPACING = 6.f;
+	static constexpr int   MAX_DETAIL_LEVEL = 8;
+
 	/* Mouse label */
 	sf::Text 			m_mouseLabel;
 
 private:
-	void BuildGrid();
-	void BuildStandardGrid();
-	void BuildCrossHairGrid();
+	void InvalidateTiles();
+	void BuildTile(GridTile& tile, const TileKey& key) const;
+	void BuildStandardTile(GridTile& tile, const TileKey& key) const;
+	void BuildCrossHairTile(GridTile& tile, const TileKey& key) const;
+	void EvictTiles();
 	void InitLabels();
 
+	float GetLineSpacing(int level) const;
+	float GetTileSize(int level) const;
+	sf::Color GetMajorLineColor() const;
+	sf::FloatRect GetTileBounds(const TileKey& key) const;
+	bool GetTileRange(const sf::FloatRect& area, int level,
+		TileKey& first, TileKey& last) const;
+
 public:
 	Grid(const sf::Vector2f& resolution, const sf::Vector2f& levelSize);
 	~Grid();
@@ -50,6 +104,13 @@ public:
 	void Draw(sf::RenderWindow& window);
 	void DrawMouseLabel(sf::RenderWindow& window);
 
+	// Detail level for a view drawn at a scale of screen pixels per world pixel
+	int  GetDetailLevel(float pixelScale) const;
+
+	// Builds any missing tiles covering an area of the level
+	void PrepareTiles(const sf::FloatRect& area, int level = 0);
+	std::size_t GetCachedTileCount() const;
+
 	void  SetUnitSize(float size);
 	float GetUnitSize() const;
 	void  IncrementUnitSize(float size);
@@ -17,6 +17,8 @@ private:
 	bool			m_rmbPressed;
 	bool 			m_panCamera;
 
+	static constexpr float ZOOM_STEP = 1.1f;	// zoom factor per wheel notch
+
 public:
 	CameraManager();
 	~CameraManager();
@@ -24,7 +26,7 @@ public:
 	CameraManager(const CameraManager&) = delete;
 	CameraManager& operator= (const CameraManager&) = delete;
 
-	void HandleInput(const sf::Event& event);
+	void HandleInput(const sf::Event& event, const sf::RenderWindow& window);
 	void Update(sf::RenderWindow& window, sf::Time& dt);
 
 	sf::View& GetCameraView();
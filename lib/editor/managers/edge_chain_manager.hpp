@@ -32,6 +32,7 @@ public:
 	void SelectCurrentChain();
 
 	void PushChain(const Vector2f& startPos);
+	void PushChain(std::vector<Vector2f>& vertices, const Vector2f& startPos);
 	void PopChain();
 
 	void AddVertexToSelectedChain();
@@ -35,13 +35,19 @@ private:
 	static bool  enable_clamp;
 	static float tween_duration;
 	static int   combo_index;
+	static float camera_zoom;
 	static std::vector<std::string> easing_labels;
 
+	/** Profiler settings */
+	static bool  show_profiler;
+	static float trace_seconds;
+
 private:
 	static void InitEasingLabels(std::vector<std::string>& vec);
 
 	void UpdateGridWindow();
 	void UpdateCameraWindow();
+	void UpdateProfilerWindow();
 	void UpdateMainWindow();
 
 public:
@@ -54,12 +60,13 @@ public:
 	ImGuiManager(const ImGuiManager&) = delete;
 	ImGuiManager& operator= (const ImGuiManager&) = delete;
 
-	void ProcessEvent(sf::Event& event);
+	void ProcessEvent(const sf::Event& event);
 	void Update(sf::RenderWindow& window, sf::Time& dt);
 	void Render(sf::RenderWindow& window);
 	void Shutdown();
 
 	bool RenderMouseCoords();
+	float GetTraceSeconds();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef INPUT_MANAGER_HPP
+#define INPUT_MANAGER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/** InputSnapshot
+ * Mouse state sampled once per frame, after the event queue is drained.
+ */
+
+struct InputSnapshot
+{
+	sf::Vector2i	mousePixel;		// relative to the window
+	sf::Vector2f	mouseWorld;		// mapped through the window's view
+	bool			mouseMoved;		// at least one MouseMoved this frame
+	std::uint64_t	frame;
+};
+
+/** InputManager
+ * Drains the SFML event queue once per frame. Runs of consecutive
+ * MouseMoved events are merged into the last one, so a high polling rate
+ * mouse doesn't repeat picking and label updates for every report.
+ * Other events keep their order.
+ *
+ * The mouse position is mapped to world coordinates once in Poll() and
+ * every manager reads it from GetSnapshot() instead of querying the
+ * window again.
+ */
+
+class InputManager
+{
+private:
+	// Pointer to the only instance of this class
+	static std::shared_ptr<InputManager> m_instance;
+
+	// Private constructor, only the class can instantiate itself
+	InputManager();
+
+private:
+	std::vector<sf::Event>	m_events;
+	InputSnapshot			m_snapshot;
+
+	std::size_t				m_rawEventCount;	// before merging, last frame
+
+public:
+	// Public static method to return the pointer to the only instance
+	static std::shared_ptr<InputManager> GetInstance();
+
+	InputManager(const InputManager&) = delete;
+	InputManager& operator= (const InputManager&) = delete;
+
+	/* Call once per frame before handling input */
+	void Poll(sf::RenderWindow& window);
+
+	const std::vector<sf::Event>& GetEvents() const;
+	const InputSnapshot& GetSnapshot() const;
+
+	std::size_t GetRawEventCount() const;
+	std::size_t GetMergedEventCount() const;
+};
+
+#endif
\ No newline at end of file
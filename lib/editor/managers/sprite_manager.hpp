@@ -6,26 +6,78 @@
 #include "editor/debug/debug_circle.hpp"
 #include "editor/debug/custom_polygon.hpp"
 #include "editor/debug/multi_shape.hpp"
+#include "editor/debug/shape_batch.hpp"
+#include "editor/callbacks/ray_query.hpp"
 #include "editor/box2d_utils.hpp"
 
-enum class ShapeType
-{
-	DebugBox = 1,
-	DebugCircle,
-	CustomPolygon,
-	MultiShape
-};
-
 class SpriteManager
 {
 private:
-	std::vector<DebugShape*>	m_debugShapes;
+	// One dense array per shape type, so update and draw loops dispatch
+	// statically and walk contiguous memory
+	std::vector<DebugBox>		m_boxes;
+	std::vector<DebugCircle>	m_circles;
+	std::vector<CustomPolygon>	m_polygons;
+	std::vector<MultiShape>		m_multiShapes;
+
+	// Owner slots packed into body user data. A slot never moves while its
+	// shape lives; it records where swap-and-pop removal put the shape.
+	struct OwnerSlot
+	{
+		ShapeType		type;
+		std::uint32_t	index;			// position in the type's array
+		std::uint32_t	generation;		// matches live owners only
+	};
+
+	std::vector<OwnerSlot>		m_owners;
+	std::vector<std::uint32_t>	m_freeOwners;
+
+	// Geometry for every live shape, rebuilt and drawn once per frame
+	ShapeBatch					m_batch;
+
 	b2World* 					m_world;
 	bool						m_destroyFlag;
 
+	// Shapes whose geometry was rebuilt in the last Update
+	unsigned int				m_activeShapeCount;
+
+	// Packed owners of on-screen shapes, gathered from the broadphase
+	std::vector<uintptr_t>		m_visibleOwners;
+	unsigned int				m_visibleShapeCount;
+
 	bool 						m_wireframeMode;
 	bool						m_rmbPressed;
 
+	// TestPointMode: owners under the cursor, found through the broadphase,
+	// and the owners currently highlighted so a reset only touches those
+	std::vector<uintptr_t>		m_pickedOwners;
+	std::vector<uintptr_t>		m_highlightedOwners;
+
+	// RayCastMode: ray from where RMB was pressed to the mouse
+	RayQueryBatch				m_rayQuery;
+	bool						m_rayCasting;
+	sf::Vector2f				m_rayStart;
+	sf::Vector2f				m_rayEnd;
+
+	// Extra pixels around the view so interpolated shapes at the edges
+	// and their outlines aren't clipped early
+	static constexpr float		CULL_MARGIN = 64.f;
+
+private:
+	DebugShape* GetShape(ShapeType type, std::uint32_t index);
+	const OwnerSlot* FindOwner(uintptr_t packedOwner) const;
+	void ReleaseOwner(const DebugShape& shape);
+
+	template <typename T, typename... Args>
+	void EmplaceShape(std::vector<T>& shapes, Args&&... args);
+
+	template <typename T>
+	std::size_t RemoveMarkedShapes(std::vector<T>& shapes);
+
+	// Slots reserved per shape type up front. Removal is swap-and-pop and
+	// never shrinks an array, so spawning into a freed slot doesn't allocate.
+	static constexpr std::size_t RESERVED_SHAPES = 1024;
+
 public:
 	static unsigned int DynamicBodiesCount;
 
@@ -38,17 +90,33 @@ public:
 	void PushShape(const ShapeType type, const sf::Vector2f& position);
 
 	void HandleInput(const sf::Event& event, sf::RenderWindow& window);
-	void Update();
+	void SaveTransforms();
+	void Update(float alpha);
+	void PrepareDraw();
+	void PrepareDraw(const sf::FloatRect& visibleArea);
 	void Draw(sf::RenderWindow& window);
 
+	const ShapeBatch& GetBatch() const;
+	unsigned int GetActiveShapeCount() const;
+	unsigned int GetVisibleShapeCount() const;
+
+	// Owner of a body from its packed user data, or nullptr. Packed owners
+	// of removed shapes resolve to nullptr.
+	DebugShape* GetShape(const b2Body* body);
+	DebugShape* GetShape(uintptr_t packedOwner);
+
 	void DestroyAllShapes();
 	void SetDestroryFlag(bool flag);
 
 	bool* GetWireframeFlag();
 	void ToggleWireframe();
 
-	void DoTestPoint(RenderWindow& window);
+	void DoTestPoint(const sf::Vector2f& point);
 	void ResetTestPoint();
+	unsigned int GetHighlightedShapeCount() const;
+
+	void DoRayCast();
+	const RayQueryBatch& GetRayQuery() const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,140 @@
+#ifndef TRIGGER_ZONE_MANAGER_HPP
+#define TRIGGER_ZONE_MANAGER_HPP
+
+#include "box2d/box2d.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/** ZoneHandle
+ * Refers to a zone owned by a TriggerZoneManager. A handle goes stale once
+ * its zone is removed, even if the slot is reused.
+ */
+struct ZoneHandle
+{
+	static constexpr std::uint32_t INVALID_INDEX = ~std::uint32_t(0);
+
+	std::uint32_t index = INVALID_INDEX;
+	std::uint32_t generation = 0;
+
+	bool IsValid() const { return index != INVALID_INDEX; }
+
+	bool operator< (const ZoneHandle& other) const
+	{
+		return index != other.index ? index < other.index : generation < other.generation;
+	}
+
+	bool operator== (const ZoneHandle& other) const
+	{
+		return index == other.index && generation == other.generation;
+	}
+};
+
+enum class TriggerEventType
+{
+	Enter,
+	Stay,
+	Exit
+};
+
+/** A body (by packed BodyUserData owner) overlapping a zone
+ * Packed owners stay the same for a shape's lifetime and change when an
+ * owner slot is reused, so a body destroyed and another created in its
+ * place report an exit and an enter.
+ */
+struct TriggerPair
+{
+	std::uintptr_t	owner;
+	ZoneHandle		zone;
+
+	bool operator< (const TriggerPair& other) const
+	{
+		return owner != other.owner ? owner < other.owner : zone < other.zone;
+	}
+
+	bool operator== (const TriggerPair& other) const
+	{
+		return owner == other.owner && zone == other.zone;
+	}
+};
+
+using TriggerCallback = std::function<void(TriggerEventType, ZoneHandle, std::uintptr_t)>;
+
+/** TriggerZoneManager
+ *
+ * Holds any number of axis aligned trigger zones in a dedicated
+ * b2DynamicTree, separate from the world's broadphase so zones never
+ * create contacts.
+ *
+ * Update() runs after b2World::Step. Each awake dynamic body queries the
+ * tree with its fixture AABBs, so the cost follows bodies and overlaps
+ * rather than zones x bodies. Sleeping bodies keep last frame's overlaps
+ * unless a zone moved. The overlaps are diffed against the previous frame
+ * into enter, stay and exit sets, and zone callbacks are only called from
+ * DispatchCallbacks(), never during the step.
+ */
+class TriggerZoneManager
+{
+private:
+	struct Zone
+	{
+		b2AABB			aabb;		// exact bounds, the tree stores a fattened copy
+		std::int32_t	proxy;		// -1 while the slot is free
+		std::uint32_t	generation;	// bumped on removal so old handles go stale
+		TriggerCallback	callback;
+	};
+
+	b2World*					m_world;
+	b2DynamicTree				m_tree;
+
+	std::vector<Zone>			m_zones;
+	std::vector<std::uint32_t>	m_freeZones;
+	std::size_t					m_zoneCount;
+	bool						m_zonesChanged;	// forces sleeping bodies to requery
+
+	// Overlaps sorted by owner then zone
+	std::vector<TriggerPair>	m_previous;
+	std::vector<TriggerPair>	m_current;
+
+	std::vector<TriggerPair>	m_enter;
+	std::vector<TriggerPair>	m_stay;
+	std::vector<TriggerPair>	m_exit;
+
+	// Set while querying the tree for one fixture
+	b2AABB						m_queryAABB;
+	std::uintptr_t				m_queryOwner;
+
+	void ReleaseZone(std::uint32_t index);
+	void QueryBody(b2Body* body, std::uintptr_t owner);
+	void KeepPreviousOverlaps(std::uintptr_t owner);
+
+public:
+	explicit TriggerZoneManager(b2World* world);
+
+	TriggerZoneManager(const TriggerZoneManager&) = delete;
+	TriggerZoneManager& operator= (const TriggerZoneManager&) = delete;
+
+	/* Bounds are in world units (metres). Stale handles are ignored. */
+	ZoneHandle AddZone(const b2AABB& aabb, TriggerCallback callback = TriggerCallback());
+	void RemoveZone(ZoneHandle zone);
+	void MoveZone(ZoneHandle zone, const b2AABB& aabb);
+	void SetCallback(ZoneHandle zone, TriggerCallback callback);
+	void Clear();
+
+	bool IsValid(ZoneHandle zone) const;
+	const b2AABB& GetZoneAABB(ZoneHandle zone) const;
+	std::size_t GetZoneCount() const;
+
+	/* Call after b2World::Step */
+	void Update();
+	void DispatchCallbacks();
+
+	const std::vector<TriggerPair>& GetEnterEvents() const;
+	const std::vector<TriggerPair>& GetStayEvents() const;
+	const std::vector<TriggerPair>& GetExitEvents() const;
+
+	/* b2DynamicTree::Query callback */
+	bool QueryCallback(std::int32_t proxyId);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef TWEEN_MANAGER_HPP
+#define TWEEN_MANAGER_HPP
+
+#include "editor/animation/easing_table.hpp"
+#include "editor/animation/tween.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/** TweenHandle
+ * Refers to a tween owned by the TweenManager. A handle goes stale once
+ * its tween finishes or is stopped, even if the slot is reused.
+ */
+
+struct TweenHandle
+{
+	static constexpr std::uint32_t INVALID_INDEX = ~std::uint32_t(0);
+
+	std::uint32_t index = INVALID_INDEX;
+	std::uint32_t generation = 0;
+
+	bool IsValid() const { return index != INVALID_INDEX; }
+};
+
+/** TweenManager
+ * Owns every running tween in a fixed size pool and updates them in a
+ * single pass each frame. Finished tweens free their slot for reuse.
+ *
+ * Tween state is stored as parallel arrays. Each update groups running
+ * tweens by easing function and evaluates each group with EaseBatch, or
+ * with a sampled EasingTable when lookup tables are enabled.
+ */
+
+class TweenManager
+{
+private:
+	// Pointer to the only instance of this class
+	static std::shared_ptr<TweenManager> m_instance;
+
+	// Private constructor, only the class can instantiate itself
+	TweenManager();
+
+	struct SlotInfo
+	{
+		std::uint32_t generation;
+		std::uint32_t activeIndex;	// position in m_active while running
+	};
+
+	static constexpr int FUNCTION_COUNT = static_cast<int>(InterpFunc::BounceEaseInOut) + 1;
+
+private:
+	/* Per slot tween state */
+	std::vector<float*>			m_property;
+	std::vector<float>			m_startValue;
+	std::vector<float>			m_targetValue;
+	std::vector<float>			m_changeValue;
+	std::vector<float>			m_duration;
+	std::vector<float>			m_elapsedTime;
+	std::vector<InterpFunc>		m_function;
+
+	std::vector<SlotInfo>		m_slots;
+	std::vector<std::uint32_t>	m_freeSlots;
+	std::vector<std::uint32_t>	m_active;		// dense list of running slots
+
+	/* Scratch arrays for grouping running tweens by easing function */
+	std::vector<std::uint32_t>	m_groupStart;
+	std::vector<std::uint32_t>	m_batchSlots;
+	std::vector<float>			m_batchT;
+	std::vector<float>			m_batchB;
+	std::vector<float>			m_batchC;
+	std::vector<float>			m_batchD;
+	std::vector<float>			m_batchOut;
+
+	/* One table per InterpFunc while lookup tables are enabled */
+	std::vector<EasingTable>	m_tables;
+
+	bool IsCurrent(const TweenHandle& handle) const;
+	void Release(std::uint32_t index);
+
+public:
+	static constexpr std::size_t MAX_TWEENS = 512;
+
+	TweenManager(const TweenManager&) = delete;
+	TweenManager& operator= (const TweenManager&) = delete;
+
+	// Public static method to return the pointer to the only instance
+	static std::shared_ptr<TweenManager> GetInstance();
+
+	// Starts animating a property. If the pool is full the property is
+	// set to its target straight away and an invalid handle is returned.
+	TweenHandle Spawn(float* property,
+		float startValue,
+		float targetValue,
+		float duration,
+		InterpFunc function);
+
+	// Stops a tween, leaving the property at its current value
+	void Stop(TweenHandle& handle);
+	void StopAll();
+
+	bool IsAnimating(const TweenHandle& handle) const;
+	void Update(float dt);
+
+	// Samples every easing curve at a resolution and evaluates tweens from
+	// the tables from then on. A resolution of 0 returns to the exact curves.
+	void UseLookupTables(std::size_t resolution = EasingTable::DEFAULT_RESOLUTION);
+	bool UsingLookupTables() const;
+	std::size_t GetLookupTableMemory() const;
+
+	std::size_t GetActiveCount() const;
+};
+
+#endif
\ No newline at end of file
@@ -13,8 +13,9 @@ sf::Vector2f GetMousePosition(const sf::RenderWindow& window);
 
 
 /** Renders a label next to the mouse cursor in the SFML window.
+ *      sf::Vector2f& - Mouse position in world coordinates
  */
-void SetMouseLabel(sf::Text& label, sf::RenderWindow& window);
+void SetMouseLabel(sf::Text& label, const sf::Vector2f& mousePos);
 
 /** Calculate difference vector between the current and previous
  *  mouse position
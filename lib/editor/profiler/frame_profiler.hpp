@@ -0,0 +1,139 @@
+#ifndef FRAME_PROFILER_HPP
+#define FRAME_PROFILER_HPP
+
+#include <box2d/box2d.h>
+#include <array>
+#include <chrono>
+#include <memory>
+#include "editor/profiler/trace_recorder.hpp"
+
+/** Timed sections of the main loop, in the order they are drawn stacked
+ *  in the profiler graph.
+ */
+enum class ProfileScope
+{
+	PollEvents = 0,
+	ImGuiUpdate,
+	CameraUpdate,
+	WorldStep,
+	EdgeChainUpdate,
+	SpriteUpdate,
+	DrawGrid,
+	DrawTriggers,
+	DrawSprites,
+	DrawEdgeChains,
+	DrawImGui,
+	Display,
+	Count
+};
+
+/** Box2D's b2Profile summed over every step taken in a frame */
+struct WorldProfile
+{
+	float step;
+	float collide;
+	float solve;
+	float solveInit;
+	float solveVelocity;
+	float solvePosition;
+	float solveTOI;
+	float broadphase;
+	int   stepCount;
+	int   contactEvents;	// contact listener events recorded
+	int   impacts;
+	int   impactCues;		// impacts left after aggregation
+};
+
+/** Timings for one rendered frame, in milliseconds */
+struct FrameSample
+{
+	std::array<float, static_cast<size_t>(ProfileScope::Count)> scopes;
+	float		 frameTime;
+	WorldProfile world;
+};
+
+/** FrameProfiler
+ *
+ * Collects scoped timer results for the current frame and keeps the last
+ * HISTORY_SIZE frames in a ring buffer for the ImGui profiler window.
+ * While a trace is recording, timer events are also forwarded to the
+ * TraceRecorder for Chrome trace export.
+ */
+class FrameProfiler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr size_t HISTORY_SIZE = 240;
+	static constexpr size_t SCOPE_COUNT = static_cast<size_t>(ProfileScope::Count);
+
+private:
+	// Pointer to the only instance of this class
+	static std::shared_ptr<FrameProfiler> m_instance;
+
+	// Private constructor, only the class can instantiate itself
+	FrameProfiler();
+
+private:
+	std::array<FrameSample, HISTORY_SIZE> m_history;
+	size_t				m_head;			// next slot to write
+	size_t				m_count;		// valid samples in m_history
+
+	FrameSample			m_current;
+	Clock::time_point	m_frameStart;
+	std::uint64_t		m_frameNumber;
+	bool				m_paused;
+
+	TraceRecorder		m_trace;
+
+public:
+	// Public static method to return the pointer to the only instance
+	static std::shared_ptr<FrameProfiler> GetInstance();
+
+	static const char* GetScopeName(ProfileScope scope);
+
+	void BeginFrame();
+	void EndFrame();
+
+	void AddScopeTime(ProfileScope scope, float milliseconds);
+	void AddScope(ProfileScope scope, Clock::time_point start,
+		Clock::time_point end);
+	void AddWorldProfile(const b2Profile& profile);
+	void AddContactEvents(int eventCount, int impactCount, int cueCount);
+	void AddCounters(int bodyCount, int contactCount, int proxyCount);
+
+	/* Chrome trace export */
+	bool StartTrace(float seconds);
+	TraceRecorder& GetTraceRecorder();
+	std::uint64_t GetFrameNumber() const;
+
+	void SetPaused(bool paused);
+	bool* GetPausedFlag();
+
+	/* Sample access, age 0 is the most recently completed frame */
+	size_t GetSampleCount() const;
+	const FrameSample& GetSample(size_t age) const;
+
+	void GetFrameTimePercentiles(float& p50, float& p95, float& p99) const;
+	FrameSample GetAverageSample() const;
+};
+
+/** ScopedTimer
+ *
+ * Adds the time between construction and destruction to a profile scope.
+ */
+class ScopedTimer
+{
+private:
+	ProfileScope						m_scope;
+	FrameProfiler::Clock::time_point	m_start;
+
+public:
+	explicit ScopedTimer(ProfileScope scope);
+	~ScopedTimer();
+
+	ScopedTimer(const ScopedTimer&) = delete;
+	ScopedTimer& operator= (const ScopedTimer&) = delete;
+};
+
+#endif
\ No newline at end of file
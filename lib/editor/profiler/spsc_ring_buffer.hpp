@@ -0,0 +1,84 @@
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/** SpscRingBuffer
+ *
+ * Bounded lock-free queue for exactly one producer thread and one consumer
+ * thread. Storage is allocated once in the constructor; Push never blocks
+ * or allocates and fails when the buffer is full.
+ */
+template <typename T>
+class SpscRingBuffer
+{
+private:
+	std::vector<T>		m_items;
+	std::size_t			m_mask;
+
+	// Head and tail sit on separate cache lines so the producer and
+	// consumer don't invalidate each other's line on every operation
+	alignas(64) std::atomic<std::size_t> m_head;	// written by consumer
+	alignas(64) std::atomic<std::size_t> m_tail;	// written by producer
+
+	static std::size_t RoundUpPowerOfTwo(std::size_t n)
+	{
+		std::size_t size = 1;
+		while (size < n)
+			size <<= 1;
+		return size;
+	}
+
+public:
+	explicit SpscRingBuffer(std::size_t capacity)
+		: m_items(RoundUpPowerOfTwo(capacity))
+		, m_mask(m_items.size() - 1)
+		, m_head(0)
+		, m_tail(0)
+	{}
+
+	SpscRingBuffer(const SpscRingBuffer&) = delete;
+	SpscRingBuffer& operator= (const SpscRingBuffer&) = delete;
+
+	/* Producer thread only */
+	bool Push(const T& item)
+	{
+		const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+		if (tail - m_head.load(std::memory_order_acquire) == m_items.size())
+			return false;
+
+		m_items[tail & m_mask] = item;
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/* Consumer thread only */
+	bool Pop(T& item)
+	{
+		const std::size_t head = m_head.load(std::memory_order_relaxed);
+
+		if (head == m_tail.load(std::memory_order_acquire))
+			return false;
+
+		item = m_items[head & m_mask];
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/* Only valid while neither side is running */
+	void Clear()
+	{
+		m_head.store(0, std::memory_order_relaxed);
+		m_tail.store(0, std::memory_order_relaxed);
+	}
+
+	std::size_t Capacity() const
+	{
+		return m_items.size();
+	}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,93 @@
+#ifndef TRACE_RECORDER_HPP
+#define TRACE_RECORDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "editor/profiler/spsc_ring_buffer.hpp"
+
+enum class ProfileScope;
+
+/** One recorded event, kept as plain data so it can cross the ring buffer */
+struct TraceEvent
+{
+	enum class Type : std::uint8_t
+	{
+		Scope,
+		Counters
+	};
+
+	Type			type;
+	ProfileScope	scope;
+	std::uint32_t	threadId;
+	std::uint64_t	frame;
+	std::int64_t	start;			// microseconds since recording began
+	std::int64_t	duration;		// microseconds (scope events)
+
+	std::int32_t	bodyCount;		// counter events
+	std::int32_t	contactCount;
+	std::int32_t	proxyCount;
+};
+
+/** TraceRecorder
+ *
+ * Records scoped timer events for a fixed number of seconds and streams
+ * them to a Chrome trace-event JSON file (chrome://tracing, Perfetto).
+ * The render thread pushes events into a preallocated lock-free buffer
+ * and a background thread formats and writes them, so recording never
+ * blocks the frame. Events are dropped, and counted, if the writer falls
+ * behind.
+ */
+class TraceRecorder
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr std::size_t BUFFER_CAPACITY = 1 << 16;
+
+private:
+	SpscRingBuffer<TraceEvent>	m_buffer;
+	std::thread					m_writer;
+
+	std::atomic<bool>			m_recording;	// producer may push
+	std::atomic<bool>			m_writing;		// writer thread running
+	std::atomic<std::uint64_t>	m_dropped;
+
+	Clock::time_point			m_startTime;
+	float						m_duration;
+	std::string					m_path;
+
+private:
+	void WriterLoop();
+	void JoinWriter();
+	std::int64_t ToMicroseconds(Clock::time_point time) const;
+
+public:
+	TraceRecorder();
+	~TraceRecorder();
+
+	TraceRecorder(const TraceRecorder&) = delete;
+	TraceRecorder& operator= (const TraceRecorder&) = delete;
+
+	/* Render thread interface */
+	bool Start(float seconds, const std::string& path);
+	void Update();
+
+	void RecordScope(ProfileScope scope, Clock::time_point start,
+		Clock::time_point end, std::uint64_t frame);
+
+	void RecordCounters(std::uint64_t frame, int bodyCount,
+		int contactCount, int proxyCount);
+
+	bool IsRecording() const;
+	bool IsWriting() const;
+	float GetProgress() const;
+	std::uint64_t GetDroppedCount() const;
+	const std::string& GetPath() const;
+
+	static std::string MakeDefaultPath();
+};
+
+#endif
\ No newline at end of file
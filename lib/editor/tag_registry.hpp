@@ -0,0 +1,47 @@
+#ifndef TAG_REGISTRY_HPP
+#define TAG_REGISTRY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Compact id of an interned tag */
+using TagId = std::uint8_t;
+
+/* Interning table mapping tag strings to compact ids. Each distinct tag
+   is stored once, so objects and b2Body user data carry a TagId instead
+   of owning a copy, and comparing tags is an integer compare. */
+class TagRegistry {
+private:
+	// Pointer to the only instance of this class
+	static std::shared_ptr<TagRegistry> m_instance;
+
+	// Private constructor, only the class can instantiate itself
+	TagRegistry();
+
+private:
+	std::vector<std::string>				m_tags;		// indexed by TagId
+	std::unordered_map<std::string, TagId>	m_ids;
+
+public:
+	static constexpr std::size_t MAX_TAGS = 256;
+
+	// Id of the empty tag, also returned when the table is full
+	static constexpr TagId NO_TAG = 0;
+
+	// Public static method to return the pointer to the only instance
+	static std::shared_ptr<TagRegistry> GetInstance();
+
+	// Returns the id of a tag, adding it on first use
+	TagId Register(const std::string& tag);
+
+	// Returns NO_TAG if the tag was never registered
+	TagId Find(const std::string& tag) const;
+
+	const std::string& GetTag(TagId id) const;
+	std::size_t GetTagCount() const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** WorkerPool
+ *
+ * Fixed set of threads that split index ranges between them. ParallelFor
+ * hands out chunks of `grain` indices from a shared counter until the
+ * range is used up; the calling thread works too and returns once every
+ * chunk has finished. Worker indices run from 0 (the caller) to
+ * GetWorkerCount() - 1, so tasks can write to per-worker buffers.
+ *
+ * Threads sleep between dispatches. Only one ParallelFor runs at a time.
+ */
+class WorkerPool
+{
+public:
+	using Task = std::function<void(std::size_t begin, std::size_t end, std::size_t worker)>;
+
+private:
+	std::vector<std::thread>	m_threads;
+
+	std::mutex					m_mutex;
+	std::condition_variable		m_wake;
+	std::condition_variable		m_done;
+
+	// Current dispatch, written under m_mutex before waking the threads
+	const Task*					m_task;
+	std::size_t					m_count;
+	std::size_t					m_grain;
+	std::atomic<std::size_t>	m_next;
+	std::size_t					m_busy;			// threads still in this dispatch
+	std::uint64_t				m_generation;
+	bool						m_quit;
+
+	void WorkerLoop(std::size_t worker);
+	void RunChunks(std::size_t worker);
+
+public:
+	/* Extra threads besides the caller; 0 runs everything inline */
+	explicit WorkerPool(std::size_t threadCount = GetDefaultThreadCount());
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator= (const WorkerPool&) = delete;
+
+	void ParallelFor(std::size_t count, std::size_t grain, const Task& task);
+
+	std::size_t GetWorkerCount() const;
+
+	/* One thread per remaining hardware thread */
+	static std::size_t GetDefaultThreadCount();
+};
+
+#endif
\ No newline at end of file
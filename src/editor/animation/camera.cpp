@@ -1,5 +1,4 @@
 #include "editor/animation/camera.hpp"
-#include "editor/box2d_utils.hpp"
 
 //#include "engine/utils.hpp"
 
@@ -26,23 +25,22 @@ Camera::Camera(const Vector2f& position,
 			   bool clamp=true)
 			   	: m_position(position)
 				, m_backgroundSize(backgroundSize)
-				, m_clampToBackground(clamp)
-				, m_tweenX(nullptr)
-				, m_tweenY(nullptr) {
+				, m_resolution(resolution)
+				, m_zoom(1.f)
+				, m_clampToBackground(clamp) {
 
 	CalculateMinMaxPos(backgroundSize, resolution);
 
 	m_interpolation = InterpFunc::QuartEaseOut;
 	m_duration = 1.f;
-	m_tweenXActive = false;
-	m_tweenYActive = false;
 }
 
-/** Deallocates camera's tween objects.
+/** Stops the camera's tweens.
 */
 Camera::~Camera() {
-	SafeDelete(m_tweenX);
-	SafeDelete(m_tweenY);
+	// Tweens point at m_position, so they must not outlive the camera
+	TweenManager::GetInstance()->Stop(m_tweenX);
+	TweenManager::GetInstance()->Stop(m_tweenY);
 }
 
 void Camera::InitDefault() {
@@ -50,6 +48,9 @@ void Camera::InitDefault() {
 	m_position.y = 0.f;
 	m_backgroundSize.x = 0.f;
 	m_backgroundSize.y = 0.f;
+	m_resolution.x = 0.f;
+	m_resolution.y = 0.f;
+	m_zoom = 1.f;
 
 	m_clampToBackground = false;
 	m_minX = 0.f;
@@ -59,10 +60,6 @@ void Camera::InitDefault() {
 
 	m_interpolation = InterpFunc::QuartEaseOut;
 	m_duration = 1.f;
-	m_tweenX = nullptr;
-	m_tweenY = nullptr;
-	m_tweenXActive = false;
-	m_tweenYActive = false;
 }
 
 void Camera::ClampPosition(const Vector2f& pos) {
@@ -75,7 +72,7 @@ void Camera::ClampPosition(const Vector2f& pos) {
 
 	if (pos.y < m_minY)
 		m_position.y = m_minY;
-	else if (pos.y < m_maxY)
+	else if (pos.y > m_maxY)
 		m_position.y = m_maxY;
 	else
 		m_position.y = pos.y;
@@ -84,17 +81,34 @@ void Camera::ClampPosition(const Vector2f& pos) {
 void Camera::CalculateMinMaxPos(const sf::Vector2u& backgroundSize,
 						const sf::Vector2f& resolution) {
 
-	m_minX = resolution.x * .5f;
-	m_minY = resolution.y * .5f;
+	m_backgroundSize = backgroundSize;
+	m_resolution = resolution;
+	CalculateMinMaxPos();
+}
+
+/** Limits are based on the zoomed view size. When the view is wider or
+* taller than the background, the camera is centred on that axis.
+*/
+void Camera::CalculateMinMaxPos() {
+	Vector2f viewSize = m_resolution * m_zoom;
+
+	m_minX = viewSize.x * .5f;
+	m_minY = viewSize.y * .5f;
 
-	m_maxX = ((float)backgroundSize.x) - (resolution.x * .5f);
-	m_maxY = ((float)backgroundSize.y) - (resolution.y * .5f);
+	m_maxX = ((float)m_backgroundSize.x) - (viewSize.x * .5f);
+	m_maxY = ((float)m_backgroundSize.y) - (viewSize.y * .5f);
+
+	if (m_minX > m_maxX)
+		m_minX = m_maxX = m_backgroundSize.x * .5f;
+
+	if (m_minY > m_maxY)
+		m_minY = m_maxY = m_backgroundSize.y * .5f;
 }
 
 void Camera::AnimateTo(const Vector2f& target) {
 
 	// Animate only if there isn't an animation already playing
-	if (m_tweenXActive || m_tweenYActive)
+	if (IsAnimating())
 		return;
 
 	SpawnTweenX(target.x);
@@ -105,18 +119,16 @@ void Camera::SpawnTweenX(float targetX) {
 	if (targetX < m_minX) targetX = m_minX;
 	if (targetX > m_maxX) targetX = m_maxX;
 
-	m_tweenX = new Tween(&m_position.x, m_position.x, targetX, m_duration, m_interpolation);
-	m_tweenX->Start();
-	m_tweenXActive = true;
+	m_tweenX = TweenManager::GetInstance()->Spawn(
+		&m_position.x, m_position.x, targetX, m_duration, m_interpolation);
 }
 
 void Camera::SpawnTweenY(float targetY) {
 	if (targetY < m_minY) targetY = m_minY;
 	if (targetY > m_maxY) targetY = m_maxY;
 
-	m_tweenY = new Tween(&m_position.y, m_position.y, targetY, m_duration, m_interpolation);
-	m_tweenY->Start();
-	m_tweenYActive = true;
+	m_tweenY = TweenManager::GetInstance()->Spawn(
+		&m_position.y, m_position.y, targetY, m_duration, m_interpolation);
 }
 
 void Camera::ClampTo(const sf::Vector2u& backgroundSize,
@@ -165,6 +177,18 @@ void Camera::SetDuration(float duration) {
 	m_duration = duration;
 }
 
+float Camera::GetZoom() const {
+	return m_zoom;
+}
+
+void Camera::SetZoom(float zoom) {
+	if (zoom < MIN_ZOOM) zoom = MIN_ZOOM;
+	if (zoom > MAX_ZOOM) zoom = MAX_ZOOM;
+
+	m_zoom = zoom;
+	CalculateMinMaxPos();
+}
+
 bool Camera::ClampEnabled() const
 {
 	return m_clampToBackground;
@@ -180,31 +204,18 @@ void Camera::ClampEnabled(bool flag)
 // ----------------------------------------------------------------------
 
 bool Camera::IsAnimating() const {
-	return (m_tweenXActive || m_tweenYActive);
+	auto tweens = TweenManager::GetInstance();
+	return tweens->IsAnimating(m_tweenX) || tweens->IsAnimating(m_tweenY);
 }
 
 void Camera::Update(float dt, sf::Vector2f& target) {
 
-	// Deallocate tweens if it has finished animating, otherwise call update()
-	if (m_tweenXActive && (!m_tweenX->IsAnimating())) {
-		m_tweenXActive = false;
-		SafeDelete(m_tweenX);
-	}
-	else if (m_tweenXActive) {
-		m_tweenX->Update(dt);
-	}
-
-	if (m_tweenYActive && (!m_tweenY->IsAnimating())) {
-		m_tweenYActive = false;
-		SafeDelete(m_tweenY);
-	}
-	else if (m_tweenYActive) {
-		m_tweenY->Update(dt);
-	}
+	// Tweens are advanced by the TweenManager before the camera updates
+	bool animating = IsAnimating();
 
 	// Camera position may be out of bounds of the background
 	if (m_clampToBackground) {
-		if (m_tweenXActive || m_tweenYActive) {
+		if (animating) {
 
 			float cameraX = 0.f;
             float cameraY = 0.f;
@@ -231,7 +242,7 @@ void Camera::Update(float dt, sf::Vector2f& target) {
 	}
 
 	// Update camera position based on the player if it's not animating
-	if (!m_tweenXActive && !m_tweenYActive)
+	if (!animating)
 	{
 		float targetX = target.x;
 		float targetY = target.y;
@@ -0,0 +1,67 @@
+#include "editor/animation/easing.hpp"
+#include <array>
+
+namespace
+{
+	constexpr int FUNCTION_COUNT = static_cast<int>(InterpFunc::BounceEaseInOut) + 1;
+
+	/* Indexed by InterpFunc, so entries must stay in enum order */
+	const std::array<EaseFunc, FUNCTION_COUNT> EASE_FUNCS = {
+		&Ease<InterpFunc::Linear>,
+
+		&Ease<InterpFunc::QuadEaseIn>,
+		&Ease<InterpFunc::QuadEaseOut>,
+		&Ease<InterpFunc::QuadEaseInOut>,
+
+		&Ease<InterpFunc::CubicEaseIn>,
+		&Ease<InterpFunc::CubicEaseOut>,
+		&Ease<InterpFunc::CubicEaseInOut>,
+
+		&Ease<InterpFunc::QuartEaseIn>,
+		&Ease<InterpFunc::QuartEaseOut>,
+		&Ease<InterpFunc::QuartEaseInOut>,
+
+		&Ease<InterpFunc::QuintEaseIn>,
+		&Ease<InterpFunc::QuintEaseOut>,
+		&Ease<InterpFunc::QuintEaseInOut>,
+
+		&Ease<InterpFunc::SineEaseIn>,
+		&Ease<InterpFunc::SineEaseOut>,
+		&Ease<InterpFunc::SineEaseInOut>,
+
+		&Ease<InterpFunc::ExpoEaseIn>,
+		&Ease<InterpFunc::ExpoEaseOut>,
+		&Ease<InterpFunc::ExpoEaseInOut>,
+
+		&Ease<InterpFunc::CircEaseIn>,
+		&Ease<InterpFunc::CircEaseOut>,
+		&Ease<InterpFunc::CircEaseInOut>,
+
+		&Ease<InterpFunc::BackEaseIn>,
+		&Ease<InterpFunc::BackEaseOut>,
+		&Ease<InterpFunc::BackEaseInOut>,
+
+		&Ease<InterpFunc::ElasticEaseIn>,
+		&Ease<InterpFunc::ElasticEaseOut>,
+		&Ease<InterpFunc::ElasticEaseInOut>,
+
+		&Ease<InterpFunc::BounceEaseIn>,
+		&Ease<InterpFunc::BounceEaseOut>,
+		&Ease<InterpFunc::BounceEaseInOut>
+	};
+
+	// Spot checks that the constexpr curves really evaluate at compile time
+	static_assert(Ease<InterpFunc::QuintEaseInOut>(.5f) == .5f, "quint in/out midpoint");
+	static_assert(Ease<InterpFunc::BounceEaseOut>(1.f) > .99f, "bounce out end point");
+}
+
+EaseFunc GetEaseFunc(InterpFunc function)
+{
+	int index = static_cast<int>(function);
+
+	// Unknown values fall back to QuartEaseOut, like the old dispatch did
+	if (index < 0 || index >= FUNCTION_COUNT)
+		return &Ease<InterpFunc::QuartEaseOut>;
+
+	return EASE_FUNCS[index];
+}
\ No newline at end of file
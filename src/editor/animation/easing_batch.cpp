@@ -0,0 +1,372 @@
+#include "editor/animation/easing.hpp"
+
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define EASING_AVX 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define EASING_SSE 1
+#endif
+
+using std::size_t;
+
+namespace
+{
+	// --------------------------------------------------------------------------------
+	// Lane types
+	// --------------------------------------------------------------------------------
+
+#if EASING_SSE
+	/* Four floats in an SSE register */
+	struct Float4
+	{
+		static constexpr size_t LANES = 4;
+		__m128 v;
+
+		Float4(__m128 x) : v(x) {}
+		Float4(float x) : v(_mm_set1_ps(x)) {}
+
+		static Float4 Load(const float* p) { return _mm_loadu_ps(p); }
+		void Store(float* p) const { _mm_storeu_ps(p, v); }
+	};
+
+	inline Float4 operator+(Float4 a, Float4 b) { return _mm_add_ps(a.v, b.v); }
+	inline Float4 operator-(Float4 a, Float4 b) { return _mm_sub_ps(a.v, b.v); }
+	inline Float4 operator*(Float4 a, Float4 b) { return _mm_mul_ps(a.v, b.v); }
+	inline Float4 operator/(Float4 a, Float4 b) { return _mm_div_ps(a.v, b.v); }
+	inline Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a.v, b.v); }
+	inline Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a.v, b.v); }
+
+	/* Lanes where a < b take x, the rest take y */
+	inline Float4 SelectLess(Float4 a, Float4 b, Float4 x, Float4 y)
+	{
+		__m128 mask = _mm_cmplt_ps(a.v, b.v);
+		return _mm_or_ps(_mm_and_ps(mask, x.v), _mm_andnot_ps(mask, y.v));
+	}
+#endif
+
+#if EASING_AVX
+	/* Eight floats in an AVX register */
+	struct Float8
+	{
+		static constexpr size_t LANES = 8;
+		__m256 v;
+
+		Float8(__m256 x) : v(x) {}
+		Float8(float x) : v(_mm256_set1_ps(x)) {}
+
+		static Float8 Load(const float* p) { return _mm256_loadu_ps(p); }
+		void Store(float* p) const { _mm256_storeu_ps(p, v); }
+	};
+
+	inline Float8 operator+(Float8 a, Float8 b) { return _mm256_add_ps(a.v, b.v); }
+	inline Float8 operator-(Float8 a, Float8 b) { return _mm256_sub_ps(a.v, b.v); }
+	inline Float8 operator*(Float8 a, Float8 b) { return _mm256_mul_ps(a.v, b.v); }
+	inline Float8 operator/(Float8 a, Float8 b) { return _mm256_div_ps(a.v, b.v); }
+	inline Float8 Min(Float8 a, Float8 b) { return _mm256_min_ps(a.v, b.v); }
+	inline Float8 Max(Float8 a, Float8 b) { return _mm256_max_ps(a.v, b.v); }
+
+	inline Float8 SelectLess(Float8 a, Float8 b, Float8 x, Float8 y)
+	{
+		return _mm256_blendv_ps(y.v, x.v, _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ));
+	}
+#endif
+
+	// --------------------------------------------------------------------------------
+	// Kernels
+	// --------------------------------------------------------------------------------
+
+	/* Curves without a vector form (sine, expo, circ, elastic) are evaluated
+	   lane by lane with the scalar curve */
+	template <InterpFunc F>
+	struct Kernel
+	{
+		template <class V>
+		static V Eval(V t)
+		{
+			float lanes[V::LANES];
+			t.Store(lanes);
+
+			for (size_t i = 0; i < V::LANES; ++i)
+				lanes[i] = Ease<F>(lanes[i]);
+
+			return V::Load(lanes);
+		}
+	};
+
+	/* Polynomial curves, written to match the scalar forms in easing.hpp */
+
+	template <> struct Kernel<InterpFunc::Linear>
+	{
+		template <class V> static V Eval(V t) { return t; }
+	};
+
+	template <> struct Kernel<InterpFunc::QuadEaseIn>
+	{
+		template <class V> static V Eval(V t) { return t * t; }
+	};
+
+	template <> struct Kernel<InterpFunc::QuadEaseOut>
+	{
+		template <class V> static V Eval(V t) { return t * (V(2.f) - t); }
+	};
+
+	template <> struct Kernel<InterpFunc::QuadEaseInOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = V(2.f) - V(2.f) * t;
+			return SelectLess(t, V(.5f), V(2.f) * t * t, V(1.f) - u * u * V(.5f));
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::CubicEaseIn>
+	{
+		template <class V> static V Eval(V t) { return t * t * t; }
+	};
+
+	template <> struct Kernel<InterpFunc::CubicEaseOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = V(1.f) - t;
+			return V(1.f) - u * u * u;
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::CubicEaseInOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = V(2.f) - V(2.f) * t;
+			return SelectLess(t, V(.5f), V(4.f) * t * t * t, V(1.f) - u * u * u * V(.5f));
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::QuartEaseIn>
+	{
+		template <class V> static V Eval(V t) { return t * t * t * t; }
+	};
+
+	template <> struct Kernel<InterpFunc::QuartEaseOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = V(1.f) - t;
+			return V(1.f) - u * u * u * u;
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::QuartEaseInOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = V(2.f) - V(2.f) * t;
+			return SelectLess(t, V(.5f), V(8.f) * t * t * t * t, V(1.f) - u * u * u * u * V(.5f));
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::QuintEaseIn>
+	{
+		template <class V> static V Eval(V t) { return t * t * t * t * t; }
+	};
+
+	template <> struct Kernel<InterpFunc::QuintEaseOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = V(1.f) - t;
+			return V(1.f) - u * u * u * u * u;
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::QuintEaseInOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = V(2.f) - V(2.f) * t;
+			return SelectLess(t, V(.5f), V(16.f) * t * t * t * t * t,
+				V(1.f) - u * u * u * u * u * V(.5f));
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::BackEaseIn>
+	{
+		template <class V> static V Eval(V t)
+		{
+			return V(easing_detail::BACK_C3) * t * t * t - V(easing_detail::BACK_C1) * t * t;
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::BackEaseOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V u = t - V(1.f);
+			return V(1.f) + V(easing_detail::BACK_C3) * u * u * u + V(easing_detail::BACK_C1) * u * u;
+		}
+	};
+
+	template <> struct Kernel<InterpFunc::BackEaseInOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V c2 = V(easing_detail::BACK_C2);
+			V u = V(2.f) * t - V(2.f);
+
+			V in  = V(4.f) * t * t * ((c2 + V(1.f)) * V(2.f) * t - c2) * V(.5f);
+			V out = (u * u * ((c2 + V(1.f)) * u + c2) + V(2.f)) * V(.5f);
+			return SelectLess(t, V(.5f), in, out);
+		}
+	};
+
+	template <class V>
+	V BounceOut(V t)
+	{
+		const float n1 = 7.5625f;
+		const float d1 = 2.75f;
+
+		V u1 = t - V(1.5f / d1);
+		V u2 = t - V(2.25f / d1);
+		V u3 = t - V(2.625f / d1);
+
+		return SelectLess(t, V(1.f / d1), V(n1) * t * t,
+			SelectLess(t, V(2.f / d1), V(n1) * u1 * u1 + V(.75f),
+			SelectLess(t, V(2.5f / d1), V(n1) * u2 * u2 + V(.9375f),
+				V(n1) * u3 * u3 + V(.984375f))));
+	}
+
+	template <> struct Kernel<InterpFunc::BounceEaseIn>
+	{
+		template <class V> static V Eval(V t) { return V(1.f) - BounceOut(V(1.f) - t); }
+	};
+
+	template <> struct Kernel<InterpFunc::BounceEaseOut>
+	{
+		template <class V> static V Eval(V t) { return BounceOut(t); }
+	};
+
+	template <> struct Kernel<InterpFunc::BounceEaseInOut>
+	{
+		template <class V> static V Eval(V t)
+		{
+			V in  = (V(1.f) - BounceOut(V(1.f) - V(2.f) * t)) * V(.5f);
+			V out = (V(1.f) + BounceOut(V(2.f) * t - V(1.f))) * V(.5f);
+			return SelectLess(t, V(.5f), in, out);
+		}
+	};
+
+	// --------------------------------------------------------------------------------
+	// Batch loops
+	// --------------------------------------------------------------------------------
+
+	/* Evaluates whole groups of lanes starting at i and advances i past them */
+	template <InterpFunc F, class V>
+	void EvaluateLanes(const float* t, const float* b, const float* c, const float* d,
+		float* out, size_t count, size_t& i)
+	{
+		for (; i + V::LANES <= count; i += V::LANES)
+		{
+			V progress = Min(Max(V::Load(t + i) / V::Load(d + i), V(0.f)), V(1.f));
+			V eased = Kernel<F>::Eval(progress);
+
+			(V::Load(b + i) + V::Load(c + i) * eased).Store(out + i);
+		}
+	}
+
+	template <InterpFunc F>
+	void EaseBatchImpl(const float* t, const float* b, const float* c, const float* d,
+		float* out, size_t count)
+	{
+		size_t i = 0;
+
+#if EASING_AVX
+		EvaluateLanes<F, Float8>(t, b, c, d, out, count, i);
+#endif
+#if EASING_SSE
+		EvaluateLanes<F, Float4>(t, b, c, d, out, count, i);
+#endif
+
+		// Remaining elements, or everything without SIMD support
+		for (; i < count; ++i)
+		{
+			float progress = t[i] / d[i];
+			progress = progress < 0.f ? 0.f : (progress > 1.f ? 1.f : progress);
+			out[i] = b[i] + c[i] * Ease<F>(progress);
+		}
+	}
+
+	using BatchFunc = void (*)(const float*, const float*, const float*, const float*,
+		float*, size_t);
+
+	constexpr int FUNCTION_COUNT = static_cast<int>(InterpFunc::BounceEaseInOut) + 1;
+
+	/* Indexed by InterpFunc, so entries must stay in enum order */
+	const BatchFunc BATCH_FUNCS[FUNCTION_COUNT] = {
+		&EaseBatchImpl<InterpFunc::Linear>,
+
+		&EaseBatchImpl<InterpFunc::QuadEaseIn>,
+		&EaseBatchImpl<InterpFunc::QuadEaseOut>,
+		&EaseBatchImpl<InterpFunc::QuadEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::CubicEaseIn>,
+		&EaseBatchImpl<InterpFunc::CubicEaseOut>,
+		&EaseBatchImpl<InterpFunc::CubicEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::QuartEaseIn>,
+		&EaseBatchImpl<InterpFunc::QuartEaseOut>,
+		&EaseBatchImpl<InterpFunc::QuartEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::QuintEaseIn>,
+		&EaseBatchImpl<InterpFunc::QuintEaseOut>,
+		&EaseBatchImpl<InterpFunc::QuintEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::SineEaseIn>,
+		&EaseBatchImpl<InterpFunc::SineEaseOut>,
+		&EaseBatchImpl<InterpFunc::SineEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::ExpoEaseIn>,
+		&EaseBatchImpl<InterpFunc::ExpoEaseOut>,
+		&EaseBatchImpl<InterpFunc::ExpoEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::CircEaseIn>,
+		&EaseBatchImpl<InterpFunc::CircEaseOut>,
+		&EaseBatchImpl<InterpFunc::CircEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::BackEaseIn>,
+		&EaseBatchImpl<InterpFunc::BackEaseOut>,
+		&EaseBatchImpl<InterpFunc::BackEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::ElasticEaseIn>,
+		&EaseBatchImpl<InterpFunc::ElasticEaseOut>,
+		&EaseBatchImpl<InterpFunc::ElasticEaseInOut>,
+
+		&EaseBatchImpl<InterpFunc::BounceEaseIn>,
+		&EaseBatchImpl<InterpFunc::BounceEaseOut>,
+		&EaseBatchImpl<InterpFunc::BounceEaseInOut>
+	};
+}
+
+void EaseBatch(InterpFunc function, const float* t, const float* b,
+	const float* c, const float* d, float* out, size_t count)
+{
+	int index = static_cast<int>(function);
+
+	if (index < 0 || index >= FUNCTION_COUNT)
+		index = static_cast<int>(InterpFunc::QuartEaseOut);
+
+	BATCH_FUNCS[index](t, b, c, d, out, count);
+}
+
+int GetEaseBatchLanes()
+{
+#if EASING_AVX
+	return 8;
+#elif EASING_SSE
+	return 4;
+#else
+	return 1;
+#endif
+}
\ No newline at end of file
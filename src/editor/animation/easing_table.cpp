@@ -0,0 +1,50 @@
+#include "editor/animation/easing_table.hpp"
+#include "editor/animation/easing.hpp"
+#include <algorithm>
+
+using std::size_t;
+
+EasingTable::EasingTable(InterpFunc function, size_t resolution)
+	: m_function(function)
+	, m_samples(std::max(resolution, MIN_RESOLUTION) + 1)
+	, m_scale(static_cast<float>(m_samples.size() - 1))
+{
+	EaseFunc ease = GetEaseFunc(function);
+	size_t last = m_samples.size() - 1;
+
+	for (size_t i = 0; i <= last; ++i)
+		m_samples[i] = ease(i / m_scale);
+}
+
+float EasingTable::Evaluate(float t) const
+{
+	t = std::min(std::max(t, 0.f), 1.f);
+
+	float x = t * m_scale;
+	size_t i = std::min(static_cast<size_t>(x), m_samples.size() - 2);
+	float fraction = x - i;
+
+	return m_samples[i] + (m_samples[i + 1] - m_samples[i]) * fraction;
+}
+
+void EasingTable::EvaluateBatch(const float* t, const float* b, const float* c,
+	const float* d, float* out, size_t count) const
+{
+	for (size_t i = 0; i < count; ++i)
+		out[i] = b[i] + c[i] * Evaluate(t[i] / d[i]);
+}
+
+InterpFunc EasingTable::GetFunction() const
+{
+	return m_function;
+}
+
+size_t EasingTable::GetResolution() const
+{
+	return m_samples.size() - 1;
+}
+
+size_t EasingTable::GetMemoryUsage() const
+{
+	return m_samples.size() * sizeof(float);
+}
\ No newline at end of file
@@ -454,3 +454,105 @@ float Interpolate::EaseInOutBounce(float t, float b, float c, float d) {
 
 	return (c * val) + b;
 }
+
+
+// evaluates any easing function by value, dispatching on every call
+float Interpolate::Evaluate(InterpFunc function, float t, float b, float c, float d) {
+	switch (function) {
+	case InterpFunc::Linear:
+		return Interpolate::Linear(t, b, c, d);
+
+	case InterpFunc::QuadEaseIn:
+		return Interpolate::EaseInQuad(t, b, c, d);
+
+	case InterpFunc::QuadEaseOut:
+		return Interpolate::EaseOutQuad(t, b, c, d);
+
+	case InterpFunc::QuadEaseInOut:
+		return Interpolate::EaseInOutQuad(t, b, c, d);
+
+	case InterpFunc::CubicEaseIn:
+		return Interpolate::EaseInCubic(t, b, c, d);
+
+	case InterpFunc::CubicEaseOut:
+		return Interpolate::EaseOutCubic(t, b, c, d);
+
+	case InterpFunc::CubicEaseInOut:
+		return Interpolate::EaseInOutCubic(t, b, c, d);
+
+	case InterpFunc::QuartEaseIn:
+		return Interpolate::EaseInQuart(t, b, c, d);
+
+	case InterpFunc::QuartEaseOut:
+		return Interpolate::EaseOutQuart(t, b, c, d);
+
+	case InterpFunc::QuartEaseInOut:
+		return Interpolate::EaseInOutQuart(t, b, c, d);
+
+	case InterpFunc::QuintEaseIn:
+		return Interpolate::EaseInQuint(t, b, c, d);
+
+	case InterpFunc::QuintEaseOut:
+		return Interpolate::EaseOutQuint(t, b, c, d);
+
+	case InterpFunc::QuintEaseInOut:
+		return Interpolate::EaseInOutQuint(t, b, c, d);
+
+	case InterpFunc::SineEaseIn:
+		return Interpolate::EaseInSine(t, b, c, d);
+
+	case InterpFunc::SineEaseOut:
+		return Interpolate::EaseOutSine(t, b, c, d);
+
+	case InterpFunc::SineEaseInOut:
+		return Interpolate::EaseInOutSine(t, b, c, d);
+
+	case InterpFunc::ExpoEaseIn:
+		return Interpolate::EaseInExpo(t, b, c, d);
+
+	case InterpFunc::ExpoEaseOut:
+		return Interpolate::EaseOutExpo(t, b, c, d);
+
+	case InterpFunc::ExpoEaseInOut:
+		return Interpolate::EaseInOutExpo(t, b, c, d);
+
+	case InterpFunc::CircEaseIn:
+		return Interpolate::EaseInCirc(t, b, c, d);
+
+	case InterpFunc::CircEaseOut:
+		return Interpolate::EaseOutCirc(t, b, c, d);
+
+	case InterpFunc::CircEaseInOut:
+		return Interpolate::EaseInOutCirc(t, b, c, d);
+
+	case InterpFunc::BackEaseIn:
+		return Interpolate::EaseInBack(t, b, c, d);
+
+	case InterpFunc::BackEaseOut:
+		return Interpolate::EaseOutBack(t, b, c, d);
+
+	case InterpFunc::BackEaseInOut:
+		return Interpolate::EaseInOutBack(t, b, c, d);
+
+	case InterpFunc::ElasticEaseIn:
+		return Interpolate::EaseInElastic(t, b, c, d);
+
+	case InterpFunc::ElasticEaseOut:
+		return Interpolate::EaseOutElastic(t, b, c, d);
+
+	case InterpFunc::ElasticEaseInOut:
+		return Interpolate::EaseInOutElastic(t, b, c, d);
+
+	case InterpFunc::BounceEaseIn:
+		return Interpolate::EaseInBounce(t, b, c, d);
+
+	case InterpFunc::BounceEaseOut:
+		return Interpolate::EaseOutBounce(t, b, c, d);
+
+	case InterpFunc::BounceEaseInOut:
+		return Interpolate::EaseInOutBounce(t, b, c, d);
+
+	default:
+		return Interpolate::EaseOutQuart(t, b, c, d);
+	}
+}
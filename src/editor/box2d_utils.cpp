@@ -77,52 +77,6 @@ void DoTestPoint(b2Fixture* fixture, const sf::Vector2f& clickPos,
 	}
 }
 
-/** DoRayCast
- * 	Cast a ray from the bottom left hand corner of the window to the passed
- *  end point. Draw the first point of contact on the passed fixture.
- */
-
-void DoRayCast(b2Fixture* fixture, sf::Vector2f& rayEndPoint, sf::RenderWindow& window)
-{
-	// Get the child shape class associated with the fixture
-	b2Shape* shape = nullptr;
-
-	if (fixture->GetType() == b2Shape::e_polygon)
-	{
-		shape = dynamic_cast<b2PolygonShape*>(fixture->GetShape());
-	}
-	else
-	{
-		shape = dynamic_cast<b2CircleShape*>(fixture->GetShape());
-	}
-
-	// Set up ray cast data
-	b2Transform transform = fixture->GetBody()->GetTransform();
-	b2RayCastInput input;
-	input.p1.Set(0.f/SCALE, 600.f/SCALE);
-	input.p2.Set(rayEndPoint.x/SCALE, rayEndPoint.y/SCALE);
-	input.maxFraction = 1.f;
-	int32 childIndex = 0;
-
-	b2RayCastOutput output;
-
-	bool hit = shape->RayCast(&output, input, transform, childIndex);
-
-	// Handle the hit
-	if (hit)
-	{
-		b2Vec2 hitPoint = input.p1 + output.fraction * (input.p2 - input.p1);
-
-		sf::CircleShape point;
-		point.setRadius(5.f);
-		point.setFillColor(sf::Color::Red);
-		point.setOrigin(sf::Vector2(5.f, 5.f));
-		point.setPosition(hitPoint.x * SCALE, hitPoint.y * SCALE);
-
-		window.draw(point);
-	}
-}
-
 /** (Deprecated) CreateCustomPolygon
  * 	Create a CustomPolygon object and add to vector.
  */
@@ -404,12 +358,13 @@ void TraverseContacts(b2World* world)
 		b2Body* bodyA = fixtureA->GetBody();
 		b2Body* bodyB = fixtureB->GetBody();
 
-		// Can access associated actor if pointer set as body's user data:
-		// MyActor* actorA = (MyActor*)bodyA->GetUserData();
+		// The owning shape is packed into the body's user data, see
+		// BodyUserData and SpriteManager::GetShape
+		BodyUserData ownerA, ownerB;
 
-		if (bodyA->GetUserData().pointer != 0)
+		if (BodyUserData::Unpack(bodyA->GetUserData(), ownerA))
 			;
-		if (bodyB->GetUserData().pointer != 0)
+		if (BodyUserData::Unpack(bodyB->GetUserData(), ownerB))
 			;
 	}
 
@@ -0,0 +1,113 @@
+#include "editor/callbacks/contact_event_buffer.hpp"
+
+using std::size_t;
+using std::uint32_t;
+
+ContactEventBuffer::ContactEventBuffer(size_t capacity)
+	: m_events(capacity)
+	, m_count(0)
+	, m_dropped(0)
+	, m_stamp(1)
+{
+	// Keep the lookup at most half full so probes stay short
+	size_t lookupSize = 1;
+	while (lookupSize < capacity * 2)
+		lookupSize <<= 1;
+
+	m_lookup.assign(lookupSize, LookupEntry{ nullptr, 0, 0 });
+}
+
+/* Bumping the stamp invalidates every lookup entry without touching them */
+void ContactEventBuffer::Clear()
+{
+	m_count = 0;
+	m_dropped = 0;
+
+	if (++m_stamp == 0)
+	{
+		for (auto& entry : m_lookup)
+			entry.stamp = 0;
+		m_stamp = 1;
+	}
+}
+
+size_t ContactEventBuffer::Hash(const b2Contact* contact) const
+{
+	auto bits = reinterpret_cast<std::uintptr_t>(contact) >> 4;
+	return static_cast<size_t>(bits * 0x9E3779B97F4A7C15ull) & (m_lookup.size() - 1);
+}
+
+ContactEvent* ContactEventBuffer::Push(ContactEventType type, b2Contact* contact)
+{
+	if (m_count == m_events.size())
+	{
+		++m_dropped;
+		return nullptr;
+	}
+
+	ContactEvent& event = m_events[m_count];
+	event.ownerA = contact->GetFixtureA()->GetBody()->GetUserData().pointer;
+	event.ownerB = contact->GetFixtureB()->GetBody()->GetUserData().pointer;
+	event.point.SetZero();
+	event.normal.SetZero();
+	event.approachSpeed = 0.f;
+	event.normalImpulse = 0.f;
+	event.type = type;
+
+	if (type == ContactEventType::Impact)
+	{
+		size_t slot = Hash(contact);
+		while (m_lookup[slot].stamp == m_stamp && m_lookup[slot].contact != contact)
+			slot = (slot + 1) & (m_lookup.size() - 1);
+
+		m_lookup[slot] = LookupEntry{ contact, static_cast<uint32_t>(m_count), m_stamp };
+	}
+
+	++m_count;
+	return &event;
+}
+
+ContactEvent* ContactEventBuffer::FindImpact(const b2Contact* contact)
+{
+	size_t slot = Hash(contact);
+
+	while (m_lookup[slot].stamp == m_stamp)
+	{
+		if (m_lookup[slot].contact == contact)
+			return &m_events[m_lookup[slot].event];
+
+		slot = (slot + 1) & (m_lookup.size() - 1);
+	}
+
+	return nullptr;
+}
+
+const ContactEvent* ContactEventBuffer::begin() const
+{
+	return m_events.data();
+}
+
+const ContactEvent* ContactEventBuffer::end() const
+{
+	return m_events.data() + m_count;
+}
+
+size_t ContactEventBuffer::size() const
+{
+	return m_count;
+}
+
+bool ContactEventBuffer::empty() const
+{
+	return m_count == 0;
+}
+
+size_t ContactEventBuffer::GetCapacity() const
+{
+	return m_events.size();
+}
+
+size_t ContactEventBuffer::GetDroppedCount() const
+{
+	return m_dropped;
+}
\ No newline at end of file
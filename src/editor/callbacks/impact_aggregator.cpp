@@ -0,0 +1,180 @@
+#include "editor/callbacks/impact_aggregator.hpp"
+#include <algorithm>
+#include <cmath>
+
+using std::size_t;
+using std::uint64_t;
+using std::uintptr_t;
+
+ImpactAggregator::ImpactAggregator(const ImpactAggregatorSettings& settings)
+	: m_settings(settings)
+	, m_impactCount(0)
+{
+	m_cues.reserve(m_settings.maxCues);
+}
+
+/* Work done by the normal impulse, or the approach speed squared for
+   impacts the solver disabled before computing an impulse */
+float ImpactAggregator::GetEnergy(const ContactEvent& event)
+{
+	if (event.normalImpulse > 0.f)
+		return .5f * event.normalImpulse * event.approachSpeed;
+
+	return .5f * event.approachSpeed * event.approachSpeed;
+}
+
+uint64_t ImpactAggregator::GetCellKey(const b2Vec2& point) const
+{
+	auto x = static_cast<std::int32_t>(std::floor(point.x / m_settings.cellSize));
+	auto y = static_cast<std::int32_t>(std::floor(point.y / m_settings.cellSize));
+
+	return static_cast<uint64_t>(static_cast<std::uint32_t>(x)) << 32 |
+		static_cast<std::uint32_t>(y);
+}
+
+/* Bodies without an owner (edge chains) always count as cooling down, so
+   they never make an impact audible on their own */
+bool ImpactAggregator::BodyCoolingDown(uintptr_t owner, float time) const
+{
+	if (owner == 0)
+		return true;
+
+	auto it = m_bodyCooldowns.find(owner);
+	return it != m_bodyCooldowns.end() && it->second > time;
+}
+
+void ImpactAggregator::PruneCooldowns(float time)
+{
+	for (auto it = m_cellCooldowns.begin(); it != m_cellCooldowns.end(); )
+		it = it->second <= time ? m_cellCooldowns.erase(it) : std::next(it);
+
+	for (auto it = m_bodyCooldowns.begin(); it != m_bodyCooldowns.end(); )
+		it = it->second <= time ? m_bodyCooldowns.erase(it) : std::next(it);
+}
+
+void ImpactAggregator::Process(const ContactEventBuffer& events, float time)
+{
+	Process(events.begin(), events.size(), time);
+}
+
+void ImpactAggregator::Process(const ContactEvent* events, size_t count, float time)
+{
+	m_cues.clear();
+	m_candidates.clear();
+	m_impactCount = 0;
+
+	PruneCooldowns(time);
+
+	/* Impacts in regions that are not cooling down */
+	for (size_t i = 0; i < count; ++i)
+	{
+		const ContactEvent& event = events[i];
+		if (event.type != ContactEventType::Impact)
+			continue;
+
+		++m_impactCount;
+
+		uint64_t cell = GetCellKey(event.point);
+		if (m_cellCooldowns.count(cell) != 0)
+			continue;
+
+		m_candidates.push_back(Candidate{ cell, GetEnergy(event), &event });
+	}
+
+	if (m_candidates.empty())
+		return;
+
+	/* Group by region, strongest first within each region */
+	std::sort(m_candidates.begin(), m_candidates.end(),
+		[](const Candidate& a, const Candidate& b)
+		{
+			return a.cell != b.cell ? a.cell < b.cell : a.energy > b.energy;
+		});
+
+	for (size_t begin = 0; begin < m_candidates.size(); )
+	{
+		uint64_t cell = m_candidates[begin].cell;
+
+		size_t end = begin + 1;
+		while (end < m_candidates.size() && m_candidates[end].cell == cell)
+			++end;
+
+		size_t firstCue = m_cues.size();
+
+		for (size_t i = begin; i < end; ++i)
+		{
+			const Candidate& candidate = m_candidates[i];
+			const ContactEvent& event = *candidate.event;
+
+			bool quiet = BodyCoolingDown(event.ownerA, time) &&
+				BodyCoolingDown(event.ownerB, time);
+
+			// Weaker impacts and impacts of quiet bodies merge into the
+			// region's strongest cue
+			if (quiet || m_cues.size() - firstCue == m_settings.maxPerCell)
+			{
+				if (m_cues.size() > firstCue)
+					++m_cues[firstCue].count;
+				continue;
+			}
+
+			m_cues.push_back(ImpactCue{ event.point, candidate.energy,
+				event.approachSpeed, event.ownerA, event.ownerB, 1 });
+		}
+
+		begin = end;
+	}
+
+	/* Keep the strongest cues */
+	if (m_cues.size() > m_settings.maxCues)
+	{
+		std::nth_element(m_cues.begin(), m_cues.begin() + m_settings.maxCues, m_cues.end(),
+			[](const ImpactCue& a, const ImpactCue& b) { return a.energy > b.energy; });
+
+		m_cues.resize(m_settings.maxCues);
+	}
+
+	std::sort(m_cues.begin(), m_cues.end(),
+		[](const ImpactCue& a, const ImpactCue& b) { return a.energy > b.energy; });
+
+	/* Start cooldowns for what made it through */
+	for (const ImpactCue& cue : m_cues)
+	{
+		m_cellCooldowns[GetCellKey(cue.point)] = time + m_settings.cellWindow;
+
+		if (cue.ownerA != 0)
+			m_bodyCooldowns[cue.ownerA] = time + m_settings.bodyCooldown;
+		if (cue.ownerB != 0)
+			m_bodyCooldowns[cue.ownerB] = time + m_settings.bodyCooldown;
+	}
+}
+
+void ImpactAggregator::Reset()
+{
+	m_cues.clear();
+	m_candidates.clear();
+	m_cellCooldowns.clear();
+	m_bodyCooldowns.clear();
+	m_impactCount = 0;
+}
+
+const std::vector<ImpactCue>& ImpactAggregator::GetCues() const
+{
+	return m_cues;
+}
+
+size_t ImpactAggregator::GetImpactCount() const
+{
+	return m_impactCount;
+}
+
+const ImpactAggregatorSettings& ImpactAggregator::GetSettings() const
+{
+	return m_settings;
+}
+
+void ImpactAggregator::SetSettings(const ImpactAggregatorSettings& settings)
+{
+	m_settings = settings;
+	m_cues.reserve(m_settings.maxCues);
+}
\ No newline at end of file
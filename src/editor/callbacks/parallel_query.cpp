@@ -0,0 +1,231 @@
+#include "editor/callbacks/parallel_query.hpp"
+#include <algorithm>
+
+using std::size_t;
+using std::uint16_t;
+using std::uint32_t;
+
+/* Every overlapping fixture is reported; return true to keep going */
+bool ParallelQueryBatch::FixtureCollector::ReportFixture(b2Fixture* fixture)
+{
+	if ((fixture->GetFilterData().categoryBits & maskBits) == 0)
+		return true;
+
+	if (point == nullptr || fixture->TestPoint(*point))
+		fixtures->push_back(fixture);
+
+	return true;
+}
+
+ParallelQueryBatch::ParallelQueryBatch()
+{}
+
+void ParallelQueryBatch::Clear()
+{
+	m_rayStart.clear();
+	m_rayEnd.clear();
+	m_rayMode.clear();
+	m_rayMask.clear();
+
+	m_shapeAABB.clear();
+	m_shapePoint.clear();
+	m_shapeType.clear();
+	m_shapeMask.clear();
+
+	m_rayFirst.clear();
+	m_rayHits.clear();
+	m_shapeFirst.clear();
+	m_fixtures.clear();
+}
+
+uint32_t ParallelQueryBatch::AddRay(const b2Vec2& start, const b2Vec2& end,
+	RayQueryMode mode, uint16_t maskBits)
+{
+	m_rayStart.push_back(start);
+	m_rayEnd.push_back(end);
+	m_rayMode.push_back(mode);
+	m_rayMask.push_back(maskBits);
+
+	return static_cast<uint32_t>(m_rayStart.size() - 1);
+}
+
+uint32_t ParallelQueryBatch::AddAABBQuery(const b2AABB& aabb, uint16_t maskBits)
+{
+	m_shapeAABB.push_back(aabb);
+	m_shapePoint.push_back(aabb.GetCenter());
+	m_shapeType.push_back(ShapeQueryType::AABB);
+	m_shapeMask.push_back(maskBits);
+
+	return static_cast<uint32_t>(m_shapeAABB.size() - 1);
+}
+
+/* A point test is a tiny AABB query followed by b2Fixture::TestPoint */
+uint32_t ParallelQueryBatch::AddPointTest(const b2Vec2& point, uint16_t maskBits)
+{
+	b2AABB aabb;
+	aabb.lowerBound = point - b2Vec2(b2_linearSlop, b2_linearSlop);
+	aabb.upperBound = point + b2Vec2(b2_linearSlop, b2_linearSlop);
+
+	m_shapeAABB.push_back(aabb);
+	m_shapePoint.push_back(point);
+	m_shapeType.push_back(ShapeQueryType::Point);
+	m_shapeMask.push_back(maskBits);
+
+	return static_cast<uint32_t>(m_shapeAABB.size() - 1);
+}
+
+/* Queries [begin, end) of the combined index space: rays first, then
+   AABB queries and point tests */
+void ParallelQueryBatch::RunQueries(const b2World* world, size_t begin, size_t end,
+	size_t worker)
+{
+	WorkerBuffers& buffers = m_workers[worker];
+	const size_t rayCount = m_rayStart.size();
+
+	for (size_t i = begin; i < end; ++i)
+	{
+		if (i < rayCount)
+		{
+			LocalResult& result = m_rayLocal[i];
+			result.worker = static_cast<uint32_t>(worker);
+			result.first = static_cast<uint32_t>(buffers.rayHits.size());
+			result.count = buffers.rays.Cast(world, m_rayStart[i], m_rayEnd[i],
+				m_rayMode[i], m_rayMask[i]);
+		}
+		else
+		{
+			size_t query = i - rayCount;
+
+			LocalResult& result = m_shapeLocal[query];
+			result.worker = static_cast<uint32_t>(worker);
+			result.first = static_cast<uint32_t>(buffers.fixtures.size());
+
+			buffers.shapes.point = m_shapeType[query] == ShapeQueryType::Point ?
+				&m_shapePoint[query] : nullptr;
+			buffers.shapes.maskBits = m_shapeMask[query];
+			world->QueryAABB(&buffers.shapes, m_shapeAABB[query]);
+
+			result.count = static_cast<uint32_t>(buffers.fixtures.size()) - result.first;
+		}
+	}
+}
+
+/* Copies worker results to their merged offsets, same index space */
+void ParallelQueryBatch::MergeResults(size_t begin, size_t end)
+{
+	const size_t rayCount = m_rayStart.size();
+
+	for (size_t i = begin; i < end; ++i)
+	{
+		if (i < rayCount)
+		{
+			const LocalResult& result = m_rayLocal[i];
+			const auto& source = m_workers[result.worker].rayHits;
+
+			std::copy_n(source.begin() + result.first, result.count,
+				m_rayHits.begin() + m_rayFirst[i]);
+		}
+		else
+		{
+			size_t query = i - rayCount;
+			const LocalResult& result = m_shapeLocal[query];
+			const auto& source = m_workers[result.worker].fixtures;
+
+			std::copy_n(source.begin() + result.first, result.count,
+				m_fixtures.begin() + m_shapeFirst[query]);
+		}
+	}
+}
+
+void ParallelQueryBatch::Execute(const b2World* world, WorkerPool& pool)
+{
+	const size_t rayCount = m_rayStart.size();
+	const size_t shapeCount = m_shapeAABB.size();
+	const size_t total = rayCount + shapeCount;
+
+	if (m_workers.size() != pool.GetWorkerCount())
+		m_workers = std::vector<WorkerBuffers>(pool.GetWorkerCount());
+
+	for (auto& buffers : m_workers)
+	{
+		buffers.rayHits.clear();
+		buffers.fixtures.clear();
+		buffers.rays.SetOutput(&buffers.rayHits);
+		buffers.shapes.fixtures = &buffers.fixtures;
+	}
+
+	m_rayLocal.resize(rayCount);
+	m_shapeLocal.resize(shapeCount);
+
+	pool.ParallelFor(total, QUERY_GRAIN,
+		[this, world](size_t begin, size_t end, size_t worker)
+		{
+			RunQueries(world, begin, end, worker);
+		});
+
+	/* Offsets of each query's results in the merged arrays */
+	m_rayFirst.resize(rayCount);
+	uint32_t rayHitCount = 0;
+	for (size_t i = 0; i < rayCount; ++i)
+	{
+		m_rayFirst[i] = rayHitCount;
+		rayHitCount += m_rayLocal[i].count;
+	}
+
+	m_shapeFirst.resize(shapeCount);
+	uint32_t fixtureCount = 0;
+	for (size_t i = 0; i < shapeCount; ++i)
+	{
+		m_shapeFirst[i] = fixtureCount;
+		fixtureCount += m_shapeLocal[i].count;
+	}
+
+	m_rayHits.resize(rayHitCount);
+	m_fixtures.resize(fixtureCount);
+
+	pool.ParallelFor(total, QUERY_GRAIN * 4,
+		[this](size_t begin, size_t end, size_t)
+		{
+			MergeResults(begin, end);
+		});
+}
+
+size_t ParallelQueryBatch::GetRayCount() const
+{
+	return m_rayStart.size();
+}
+
+uint32_t ParallelQueryBatch::GetFirstRayHit(uint32_t ray) const
+{
+	return m_rayFirst[ray];
+}
+
+uint32_t ParallelQueryBatch::GetRayHitCount(uint32_t ray) const
+{
+	return m_rayLocal[ray].count;
+}
+
+const std::vector<RayHit>& ParallelQueryBatch::GetRayHits() const
+{
+	return m_rayHits;
+}
+
+size_t ParallelQueryBatch::GetShapeQueryCount() const
+{
+	return m_shapeAABB.size();
+}
+
+uint32_t ParallelQueryBatch::GetFirstFixture(uint32_t query) const
+{
+	return m_shapeFirst[query];
+}
+
+uint32_t ParallelQueryBatch::GetFixtureCount(uint32_t query) const
+{
+	return m_shapeLocal[query].count;
+}
+
+const std::vector<b2Fixture*>& ParallelQueryBatch::GetFixtures() const
+{
+	return m_fixtures;
+}
\ No newline at end of file
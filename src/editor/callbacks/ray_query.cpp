@@ -0,0 +1,189 @@
+#include "editor/callbacks/ray_query.hpp"
+#include <algorithm>
+
+using std::size_t;
+using std::uint16_t;
+using std::uint32_t;
+
+// --------------------------------------------------------------------------------
+// RayHitCollector
+// --------------------------------------------------------------------------------
+
+RayHitCollector::RayHitCollector(std::vector<RayHit>* hits)
+	: m_hits(hits)
+	, m_mode(RayQueryMode::Closest)
+	, m_maskBits(0xFFFF)
+	, m_firstHit(0)
+	, m_hitCount(0)
+{}
+
+void RayHitCollector::SetOutput(std::vector<RayHit>* hits)
+{
+	m_hits = hits;
+}
+
+uint32_t RayHitCollector::Cast(const b2World* world, const b2Vec2& start,
+	const b2Vec2& end, RayQueryMode mode, uint16_t maskBits)
+{
+	m_mode = mode;
+	m_maskBits = maskBits;
+	m_hitCount = 0;
+
+	// Box2D asserts on zero length rays
+	if ((end - start).LengthSquared() <= b2_epsilon * b2_epsilon)
+		return 0;
+
+	m_firstHit = m_hits->size();
+	world->RayCast(this, start, end);
+
+	// Hits are reported in tree order, not distance order
+	if (mode == RayQueryMode::All && m_hitCount > 1)
+	{
+		std::sort(m_hits->begin() + m_firstHit, m_hits->end(),
+			[](const RayHit& a, const RayHit& b) { return a.fraction < b.fraction; });
+	}
+
+	return m_hitCount;
+}
+
+/* Return values steer b2World::RayCast:
+     -1       ignore the fixture
+      0       stop the ray
+      fraction clip the ray to this hit
+      1       continue unclipped */
+float RayHitCollector::ReportFixture(b2Fixture* fixture, const b2Vec2& point,
+	const b2Vec2& normal, float fraction)
+{
+	if (fixture->IsSensor() || (fixture->GetFilterData().categoryBits & m_maskBits) == 0)
+		return -1.f;
+
+	RayHit hit{ fixture, point, normal, fraction };
+
+	switch (m_mode)
+	{
+	case RayQueryMode::Closest:
+		// Later reports are always nearer, as the ray is clipped to each hit
+		if (m_hitCount == 0)
+		{
+			m_hits->push_back(hit);
+			m_hitCount = 1;
+		}
+		else
+			m_hits->back() = hit;
+		return fraction;
+
+	case RayQueryMode::Any:
+		m_hits->push_back(hit);
+		m_hitCount = 1;
+		return 0.f;
+
+	case RayQueryMode::All:
+	default:
+		return KeepNearest(hit);
+	}
+}
+
+/* Appends hits until the ray has MAX_HITS_PER_RAY, then replaces the
+   farthest. The ray is clipped to the farthest kept hit from then on, so
+   every later report is nearer than it. */
+float RayHitCollector::KeepNearest(const RayHit& hit)
+{
+	auto nearer = [](const RayHit& a, const RayHit& b) { return a.fraction < b.fraction; };
+
+	if (m_hitCount < MAX_HITS_PER_RAY)
+	{
+		m_hits->push_back(hit);
+		if (++m_hitCount < MAX_HITS_PER_RAY)
+			return 1.f;
+	}
+	else
+		*std::max_element(m_hits->begin() + m_firstHit, m_hits->end(), nearer) = hit;
+
+	return std::max_element(m_hits->begin() + m_firstHit, m_hits->end(), nearer)->fraction;
+}
+
+// --------------------------------------------------------------------------------
+// RayQueryBatch
+// --------------------------------------------------------------------------------
+
+RayQueryBatch::RayQueryBatch()
+	: m_collector(&m_hits)
+{}
+
+void RayQueryBatch::Reserve(size_t rayCount, size_t hitCount)
+{
+	m_start.reserve(rayCount);
+	m_end.reserve(rayCount);
+	m_mode.reserve(rayCount);
+	m_maskBits.reserve(rayCount);
+	m_firstHit.reserve(rayCount);
+	m_hitCount.reserve(rayCount);
+	m_hits.reserve(hitCount);
+}
+
+void RayQueryBatch::Clear()
+{
+	m_start.clear();
+	m_end.clear();
+	m_mode.clear();
+	m_maskBits.clear();
+	m_firstHit.clear();
+	m_hitCount.clear();
+	m_hits.clear();
+}
+
+uint32_t RayQueryBatch::AddRay(const b2Vec2& start, const b2Vec2& end,
+	RayQueryMode mode, uint16_t maskBits)
+{
+	m_start.push_back(start);
+	m_end.push_back(end);
+	m_mode.push_back(mode);
+	m_maskBits.push_back(maskBits);
+
+	return static_cast<uint32_t>(m_start.size() - 1);
+}
+
+void RayQueryBatch::Execute(const b2World* world)
+{
+	const size_t rayCount = m_start.size();
+
+	m_firstHit.resize(rayCount);
+	m_hitCount.resize(rayCount);
+	m_hits.clear();
+
+	for (size_t ray = 0; ray < rayCount; ++ray)
+	{
+		m_firstHit[ray] = static_cast<uint32_t>(m_hits.size());
+
+		m_hitCount[ray] = m_collector.Cast(world, m_start[ray], m_end[ray],
+			m_mode[ray], m_maskBits[ray]);
+	}
+}
+
+size_t RayQueryBatch::GetRayCount() const
+{
+	return m_start.size();
+}
+
+uint32_t RayQueryBatch::GetFirstHit(uint32_t ray) const
+{
+	return m_firstHit[ray];
+}
+
+uint32_t RayQueryBatch::GetHitCount(uint32_t ray) const
+{
+	return m_hitCount[ray];
+}
+
+const RayHit* RayQueryBatch::GetClosestHit(uint32_t ray) const
+{
+	if (ray >= m_hitCount.size() || m_hitCount[ray] == 0)
+		return nullptr;
+
+	return &m_hits[m_firstHit[ray]];
+}
+
+const std::vector<RayHit>& RayQueryBatch::GetHits() const
+{
+	return m_hits;
+}
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "editor/callbacks/trigger_zone.hpp"
+#include "editor/culling.hpp"
+#include "editor/managers/input_manager.hpp"
 
 /** MyQueryCallback::ReportFixture
  *
@@ -8,7 +10,6 @@
 
 bool MyQueryCallback::ReportFixture(b2Fixture* fixture)
 {
-	std::cout << "MyQueryCallback::ReportFixture - Entered AABB\n";
 	b2Body* body = fixture->GetBody();
 	body->SetAwake(true);
 	return true;
@@ -32,6 +33,7 @@ TriggerZone::TriggerZone(const sf::Vector2f& position, const sf::Vector2f& size)
 	m_position = position;
 	m_size = size;
 	m_color = sf::Color(0.f, 0.f, 255.f, 64.f);
+	m_occupied = false;
 
 	m_sprite.setSize(size);
 	m_sprite.setPosition(position);
@@ -71,6 +73,22 @@ void TriggerZone::Query(b2World* world)
 	world->QueryAABB(&m_callback, aabb);
 }
 
+b2AABB TriggerZone::GetAABB() const
+{
+	b2AABB aabb;
+	aabb.lowerBound = m_lower;
+	aabb.upperBound = m_upper;
+	return aabb;
+}
+
+/* Tint the zone while a body is inside it */
+void TriggerZone::SetOccupied(bool occupied)
+{
+	m_occupied = occupied;
+	m_color.g = occupied ? 160 : 0;
+	m_color.b = occupied ? 0 : 255;
+}
+
 void TriggerZone::HandleInput(const sf::Event& event)
 {
 	// Mouse Button Pressed
@@ -104,7 +122,7 @@ void TriggerZone::HandleInput(const sf::Event& event)
 
 void TriggerZone::Update(sf::RenderWindow& window)
 {
-	auto mousePos = GetMousePosition(window);
+	auto mousePos = InputManager::GetInstance()->GetSnapshot().mouseWorld;
 
 	// Set hover color
 	if (m_hoveringOnZone)
@@ -196,6 +214,10 @@ bool TriggerZone::ZoneBeingDraggedByMouse()
 
 void TriggerZone::Draw(sf::RenderWindow& window)
 {
+	// Margin covers the corner handle drawn past the zone's edge
+	if (!GetViewBounds(window.getView(), 20.f).intersects(GetFloatRect()))
+		return;
+
 	window.draw(m_sprite);
 	m_cornerHandle->Draw(window);
 }
@@ -15,6 +15,7 @@ MoveHandle::MoveHandle(shared_ptr<BoundingBox> boundingBox, const String& label)
 {
 	m_hoverState = false;
 	m_size = 20.f;
+	m_labelWidth = -1.f;
 
 	m_color = Color(102.f, 0.f, 102.f, 56.f);
 	m_hoverColor = Color(102.f, 0.f, 102.f, 128.f);
@@ -50,9 +51,18 @@ void MoveHandle::Calculate(shared_ptr<BoundingBox> boundingBox)
 	m_position.x = bbRect.left + (bbRect.width * 0.5f);
 	m_position.y = bbRect.top;
 	m_sprite.setPosition(m_position);
+}
+
+/* Text metrics need the font's glyph texture and so a GL context. They are
+   only queried once the label is drawn or hit-tested, which lets chains be
+   built without a window (e.g. the headless runner). */
+void MoveHandle::LayoutLabel() const
+{
+	if (m_labelWidth < 0.f)
+		m_labelWidth = m_label.getLocalBounds().width;
 
 	m_label.setPosition(
-		m_position.x - (m_label.getLocalBounds().width * 0.5f),
+		m_position.x - (m_labelWidth * 0.5f),
 		m_position.y - ((m_size * 1.9f)));
 }
 
@@ -61,9 +71,6 @@ void MoveHandle::Update(Vector2f& moveIncrement)
 {
 	m_position += moveIncrement;
 	m_sprite.setPosition(m_position);
-
-	Vector2f newLabelPos = m_label.getPosition() + moveIncrement;
-	m_label.setPosition(newLabelPos);
 }
 
 // Update when bounding box changed
@@ -74,6 +81,8 @@ void MoveHandle::Update(shared_ptr<BoundingBox> boundingBox)
 
 void MoveHandle::Draw(RenderWindow& window, bool inEditMode)
 {
+	LayoutLabel();
+
 	// Draw sprite if this edge chain is selected
 	if (inEditMode)
 	{
@@ -118,6 +127,7 @@ Vector2f MoveHandle::GetPosition()
 
 FloatRect MoveHandle::GetLabelRectangle() const
 {
+	LayoutLabel();
 	return m_label.getGlobalBounds();
 }
 
@@ -1,7 +1,9 @@
 #include "editor/chains/static_edge_chain.hpp"
 #include "editor/managers/edge_chain_manager.hpp"
 #include "editor/mouse_utils.hpp"
+#include "editor/managers/input_manager.hpp"
 #include "editor/constants.hpp"
+#include "editor/culling.hpp"
 
 using sf::Color;
 using sf::Vector2f;
@@ -291,6 +293,21 @@ FloatRect StaticEdgeChain::GetMoveHandleLabelRect() const
 	return m_moveHandle->GetLabelRectangle();
 }
 
+/* Area covered by the chain, its handles and the move handle label */
+FloatRect StaticEdgeChain::GetDrawBounds() const
+{
+	// Largest handle radius drawn around a vertex or the bounding box
+	const float handleMargin = 24.f;
+
+	FloatRect bounds = m_boundingBox->GetBoundingBox();
+	bounds.left -= handleMargin;
+	bounds.top -= handleMargin;
+	bounds.width += handleMargin * 2.f;
+	bounds.height += handleMargin * 2.f;
+
+	return Merge(bounds, m_moveHandle->GetLabelRectangle());
+}
+
 void StaticEdgeChain::SetAddVertexFlag(bool flag)
 {
 	m_addVertex = flag;
@@ -352,7 +369,7 @@ void StaticEdgeChain::HandleInput(const Event& event, RenderWindow& window)
 void StaticEdgeChain::Update(RenderWindow& window, b2World* world)
 {
 	// Get mouse position
-	Vector2f mousePos = GetMousePosition(window);
+	Vector2f mousePos = InputManager::GetInstance()->GetSnapshot().mouseWorld;
 
 	if (m_editable)
 	{
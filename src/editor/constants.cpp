@@ -0,0 +1,6 @@
+#include "editor/constants.hpp"
+
+// Set initial editor mode
+RMBMode EditorSettings::mode = RMBMode::PanCameraMode;
+sf::Vector2u EditorSettings::levelSize;
+sf::Vector2f EditorSettings::RESOLUTION;
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "editor/culling.hpp"
+#include "editor/constants.hpp"
+#include <algorithm>
+
+using sf::FloatRect;
+using sf::Vector2f;
+
+FloatRect GetViewBounds(const sf::View& view, float margin)
+{
+	const Vector2f& center = view.getCenter();
+	const Vector2f& size = view.getSize();
+
+	return FloatRect(
+		center.x - size.x * .5f - margin,
+		center.y - size.y * .5f - margin,
+		size.x + margin * 2.f,
+		size.y + margin * 2.f);
+}
+
+b2AABB ToAABB(const FloatRect& rect)
+{
+	b2AABB aabb;
+	aabb.lowerBound.Set(rect.left / SCALE, rect.top / SCALE);
+	aabb.upperBound.Set((rect.left + rect.width) / SCALE,
+		(rect.top + rect.height) / SCALE);
+	return aabb;
+}
+
+FloatRect Merge(const FloatRect& a, const FloatRect& b)
+{
+	float left = std::min(a.left, b.left);
+	float top = std::min(a.top, b.top);
+	float right = std::max(a.left + a.width, b.left + b.width);
+	float bottom = std::max(a.top + a.height, b.top + b.height);
+
+	return FloatRect(left, top, right - left, bottom - top);
+}
\ No newline at end of file
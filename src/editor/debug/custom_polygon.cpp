@@ -1,4 +1,5 @@
 #include "editor/debug/custom_polygon.hpp"
+#include <algorithm>
 
 using sf::Vector2f;
 using sf::RenderWindow;
@@ -10,7 +11,7 @@ using std::cout;
 
 CustomPolygon::CustomPolygon(const Vector2f& position,
 		const vector<Vector2f>& vertices, b2World* world)
-	: DebugShape(position, "custom_polygon")
+	: DebugShape(position, "custom_polygon", ShapeType::CustomPolygon)
 {
 	++CustomPolygonCount;
 
@@ -18,20 +19,13 @@ CustomPolygon::CustomPolygon(const Vector2f& position,
 	m_color = Color::Magenta;
 	m_wireframe = false;
 	m_body = nullptr;
+	m_multipleFixture = false;
 
-	m_vertices = vertices;
-	m_vertexCount = m_vertices.size();
+	m_vertexCount = std::min<size_t>(vertices.size(), b2_maxPolygonVertices);
+	std::copy_n(vertices.begin(), m_vertexCount, m_vertices.begin());
 
-	// Initialise SFML vertex array
-	m_wireframe ? m_vertexArray.setPrimitiveType(sf::LineStrip) :
-					m_vertexArray.setPrimitiveType(sf::TriangleFan);
-
-	m_vertexArray.resize(m_vertexCount + 1);
-	for (size_t i = 0; i < m_vertexCount + 1; ++i)
-	{
-		m_vertexArray[i].position = m_vertices[i];
-		m_vertexArray[i].color = m_color;
-	}
+	// Rendered vertices, drawn through the sprite manager's shape batch
+	m_worldVertices = m_vertices;
 
 	CreateBody();
 }
@@ -49,11 +43,47 @@ CustomPolygon::~CustomPolygon()
 	//cout << "--BodyCount (CustomPolygon)\n";
 }
 
+CustomPolygon::CustomPolygon(CustomPolygon&& other) noexcept
+	: DebugShape(std::move(other))
+	, m_vertices(other.m_vertices)
+	, m_worldVertices(other.m_worldVertices)
+	, m_color(other.m_color)
+	, m_vertexCount(other.m_vertexCount)
+	, m_wireframe(other.m_wireframe)
+	, m_body(other.m_body)
+	, m_world(other.m_world)
+	, m_multipleFixture(other.m_multipleFixture)
+{
+	++CustomPolygonCount;
+	other.m_body = nullptr;
+}
+
+CustomPolygon& CustomPolygon::operator= (CustomPolygon&& other) noexcept
+{
+	if (this != &other)
+	{
+		DeleteBody();
+		DebugShape::operator=(std::move(other));
+
+		m_vertices = other.m_vertices;
+		m_worldVertices = other.m_worldVertices;
+		m_color = other.m_color;
+		m_vertexCount = other.m_vertexCount;
+		m_wireframe = other.m_wireframe;
+		m_body = other.m_body;
+		m_world = other.m_world;
+		m_multipleFixture = other.m_multipleFixture;
+
+		other.m_body = nullptr;
+	}
+
+	return *this;
+}
 
 void CustomPolygon::CreateBody()
 {
 	// Initialise b2Body vertices
-	b2Vec2 scaledVertices[m_vertexCount];
+	b2Vec2 scaledVertices[b2_maxPolygonVertices];
 
 	for (size_t i = 0; i < m_vertexCount; ++i)
 		scaledVertices[i].Set(m_vertices[i].x / SCALE, m_vertices[i].y / SCALE);
@@ -70,8 +100,7 @@ void CustomPolygon::CreateBody()
 	bodyDef.bullet = false;
 	bodyDef.enabled = true;
 
-	if (!m_tag->empty())
-		bodyDef.userData.pointer = reinterpret_cast<uintptr_t>(m_tag);
+	bodyDef.userData = MakeUserData();
 
 	m_body = m_world->CreateBody(&bodyDef);
 
@@ -85,6 +114,8 @@ void CustomPolygon::CreateBody()
 	fixtureDef.friction = .7f;
 	fixtureDef.shape = &shape;
 	m_body->CreateFixture(&fixtureDef);
+
+	SavePreviousTransform(m_body);
 }
 
 void CustomPolygon::SetColor(const Color& color)
@@ -95,11 +126,6 @@ void CustomPolygon::SetColor(const Color& color)
 void CustomPolygon::SetWireframe(bool wireframe)
 {
 	m_wireframe = wireframe;
-
-	if (m_wireframe)
-		m_vertexArray.setPrimitiveType(sf::LineStrip);
-	else
-		m_vertexArray.setPrimitiveType(sf::TriangleFan);
 }
 
 bool CustomPolygon::IsWireframe() const
@@ -116,10 +142,21 @@ void CustomPolygon::DeleteBody()
 	}
 }
 
-void CustomPolygon::Update()
+void CustomPolygon::SaveTransform()
 {
+	SavePreviousTransform(m_body);
+}
+
+bool CustomPolygon::Update(float alpha)
+{
+	// Keep cached geometry while the body sleeps where it was built
+	if (IsResting(m_body))
+		return false;
+
 	if (m_body->GetType() == b2_dynamicBody)
 	{
+		float angle = 0.f;
+		b2Transform transform = GetInterpolatedTransform(m_body, alpha, angle);
 
 		b2Fixture* fixture = m_body->GetFixtureList();
 
@@ -133,18 +170,13 @@ void CustomPolygon::Update()
 					b2PolygonShape* shape =
 						dynamic_cast<b2PolygonShape*>(fixture->GetShape());
 
-					// Update SFML vertex array
+					// Update rendered vertices
 					for (size_t i = 0; i < m_vertexCount; ++i)
 					{
-						b2Vec2 point = m_body->GetWorldPoint(shape->m_vertices[i]);
-						m_vertexArray[i].position = Vector2f(point.x*SCALE, point.y*SCALE);
+						b2Vec2 point = b2Mul(transform, shape->m_vertices[i]);
+						m_worldVertices[i] = Vector2f(point.x*SCALE, point.y*SCALE);
 					}
 
-					// Connect last vertex with first vertex for a closed shape
-					b2Vec2 firstPoint = m_body->GetWorldPoint(shape->m_vertices[0]);
-					m_vertexArray[m_vertexCount].position =
-						Vector2f(firstPoint.x*SCALE, firstPoint.y*SCALE);
-
 					break;
 				}
 				default:
@@ -154,6 +186,9 @@ void CustomPolygon::Update()
 			fixture = fixture->GetNext();
 		}
 	}
+
+	UpdateRestingState(m_body);
+	return true;
 }
 
 Vector2f CustomPolygon::GetBodyPosition() const
@@ -162,42 +197,25 @@ Vector2f CustomPolygon::GetBodyPosition() const
 	return Vector2f(pos.x*SCALE, pos.y*SCALE);
 }
 
-void CustomPolygon::Draw(RenderWindow& window)
+void CustomPolygon::AppendGeometry(ShapeBatch& batch) const
 {
-	window.draw(m_vertexArray);
+	if (m_wireframe)
+		batch.AddLineLoop(m_worldVertices.data(), m_vertexCount, m_color);
+	else
+		batch.AddConvexPolygon(m_worldVertices.data(), m_vertexCount, m_color);
 }
 
-void CustomPolygon::DoTestPoint(const Vector2f& point)
+void CustomPolygon::SetHighlighted(bool highlighted)
 {
-	if (m_body->GetType() == b2_dynamicBody)
-	{
-		b2Fixture* fixture = m_body->GetFixtureList();
-
-		while (fixture != NULL)
-		{
-			b2Vec2 scaledPoint(point.x/SCALE, point.y/SCALE);
-
-			if (fixture->TestPoint(scaledPoint))
-			{
-				SetVertexColor(Color::Green);
-			}
-			else
-			{
-				SetVertexColor(Color::Magenta);
-			}
-
-			fixture = fixture->GetNext();
-		}
-	}
+	SetVertexColor(highlighted ? Color::Green : Color::Magenta);
 }
 
-void CustomPolygon::ResetTestPoint()
+void CustomPolygon::SetVertexColor(const Color& color)
 {
-	SetVertexColor(Color::Magenta);
+	m_color = color;
 }
 
-void CustomPolygon::SetVertexColor(const Color& color)
+b2Body* CustomPolygon::GetBody() const
 {
-	for (int i = 0; i < m_vertexCount; ++i)
-		m_vertexArray[i].color = color;
+	return m_body;
 }
\ No newline at end of file
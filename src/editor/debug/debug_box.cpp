@@ -9,26 +9,21 @@ using std::string;
 using std::cout;
 
 DebugBox::DebugBox(const Vector2f& position,
-	b2World* world) : DebugShape(position, "debug_box")
+	b2World* world) : DebugShape(position, "debug_box", ShapeType::DebugBox)
 {
 	++DebugBoxCount;
 	m_size = 32.f;
 	m_world = world;
-
-	m_sprite.setPosition(m_position);
-	m_sprite.setSize(Vector2f(m_size, m_size));
-	m_sprite.setOrigin(m_size/2, m_size/2);
-	m_sprite.setFillColor(Color::White);
-	m_sprite.setOutlineColor(Color::Black);
-	m_sprite.setOutlineThickness(2);
+	m_angle = 0.f;
+	m_fillColor = Color::White;
+	m_body = nullptr;
+	m_testPointActive = false;
 
 	CreateBody();
 }
 
 DebugBox::~DebugBox()
 {
-	SafeDelete(m_tag);
-
 	if (m_body != nullptr)
 	{
 		m_world->DestroyBody(m_body);
@@ -40,6 +35,39 @@ DebugBox::~DebugBox()
 	//cout << "--BodyCount (DebugBox)\n";
 }
 
+DebugBox::DebugBox(DebugBox&& other) noexcept
+	: DebugShape(std::move(other))
+	, m_size(other.m_size)
+	, m_angle(other.m_angle)
+	, m_fillColor(other.m_fillColor)
+	, m_body(other.m_body)
+	, m_world(other.m_world)
+	, m_testPointActive(other.m_testPointActive)
+{
+	++DebugBoxCount;
+	other.m_body = nullptr;
+}
+
+DebugBox& DebugBox::operator= (DebugBox&& other) noexcept
+{
+	if (this != &other)
+	{
+		DeleteBody();
+		DebugShape::operator=(std::move(other));
+
+		m_size = other.m_size;
+		m_angle = other.m_angle;
+		m_fillColor = other.m_fillColor;
+		m_body = other.m_body;
+		m_world = other.m_world;
+		m_testPointActive = other.m_testPointActive;
+
+		other.m_body = nullptr;
+	}
+
+	return *this;
+}
+
 void DebugBox::CreateBody()
 {
 	b2BodyDef bodyDef;
@@ -50,8 +78,7 @@ void DebugBox::CreateBody()
 	bodyDef.allowSleep = true;
 	bodyDef.awake = true;
 
-	if (!m_tag->empty())
-		bodyDef.userData.pointer = reinterpret_cast<uintptr_t>(m_tag);
+	bodyDef.userData = MakeUserData();
 
 	m_body = m_world->CreateBody(&bodyDef);
 
@@ -64,6 +91,8 @@ void DebugBox::CreateBody()
 	fixtureDef.friction = 0.7f;
 	fixtureDef.shape = &shape;
 	m_body->CreateFixture(&fixtureDef);
+
+	SavePreviousTransform(m_body);
 }
 
 void DebugBox::DeleteBody()
@@ -75,10 +104,22 @@ void DebugBox::DeleteBody()
 	}
 }
 
-void DebugBox::Update()
+void DebugBox::SaveTransform()
 {
+	SavePreviousTransform(m_body);
+}
+
+bool DebugBox::Update(float alpha)
+{
+	// Keep cached geometry while the body sleeps where it was built
+	if (IsResting(m_body))
+		return false;
+
 	if (m_body->GetType() == b2_dynamicBody)
 	{
+		float angle = 0.f;
+		b2Transform transform = GetInterpolatedTransform(m_body, alpha, angle);
+
 		b2Fixture* fixture = m_body->GetFixtureList();
 
 		while (fixture != NULL)
@@ -87,10 +128,9 @@ void DebugBox::Update()
 			{
 				case b2Shape::e_polygon:
 				{
-					m_position.x = m_body->GetPosition().x * SCALE;
-					m_position.y = m_body->GetPosition().y * SCALE;
-					m_sprite.setPosition(m_position);
-					m_sprite.setRotation(m_body->GetAngle() * 180/b2_pi);
+					m_position.x = transform.p.x * SCALE;
+					m_position.y = transform.p.y * SCALE;
+					m_angle = angle;
 					break;
 				}
 				default:
@@ -100,23 +140,14 @@ void DebugBox::Update()
 			fixture = fixture->GetNext();
 		}
 	}
-}
 
-void DebugBox::Draw(RenderWindow& window)
-{
-	window.draw(m_sprite);
+	UpdateRestingState(m_body);
+	return true;
 }
 
-string* DebugBox::GetUserData()
+void DebugBox::AppendGeometry(ShapeBatch& batch) const
 {
-	b2BodyUserData data = m_body->GetUserData();
-
-	if (data.pointer != 0)
-	{
-		return reinterpret_cast<string*>(data.pointer);
-	}
-
-	return nullptr;
+	batch.AddBox(m_position, m_size, m_angle, m_fillColor, 2.f, Color::Black);
 }
 
 sf::Vector2f DebugBox::GetPosition() const
@@ -124,31 +155,9 @@ sf::Vector2f DebugBox::GetPosition() const
 	return m_position;
 }
 
-void DebugBox::DoTestPoint(const Vector2f& point)
-{
-	if (m_body->GetType() == b2_dynamicBody)
-	{
-		b2Fixture* fixture = m_body->GetFixtureList();
-
-		if (fixture != NULL)
-		{
-			b2Vec2 scaledPoint(point.x/SCALE, point.y/SCALE);
-
-			if (fixture->TestPoint(scaledPoint))
-			{
-				m_sprite.setFillColor(Color::Blue);
-			}
-			else
-			{
-				m_sprite.setFillColor(Color::White);
-			}
-		}
-	}
-}
-
-void DebugBox::ResetTestPoint()
+void DebugBox::SetHighlighted(bool highlighted)
 {
-	m_sprite.setFillColor(Color::White);
+	m_fillColor = highlighted ? Color::Blue : Color::White;
 }
 
 // TMP ----------------------------------------------------------------------
@@ -194,4 +203,9 @@ void DebugBox::ApplyAngularImpulse()
 	float impulse = -10.f;
 
 	m_body->ApplyAngularImpulse(impulse, true);
+}
+
+b2Body* DebugBox::GetBody() const
+{
+	return m_body;
 }
\ No newline at end of file
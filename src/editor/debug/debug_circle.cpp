@@ -7,18 +7,13 @@ using std::string;
 using std::cout;
 
 DebugCircle::DebugCircle(const Vector2f& position,
-	b2World* world) : DebugShape(position, "debug_circle")
+	b2World* world) : DebugShape(position, "debug_circle", ShapeType::DebugCircle)
 {
 	++DebugCircleCount;
 	m_radius = 18.f;
 	m_world = world;
-
-	m_sprite.setPosition(m_position);
-	m_sprite.setRadius(m_radius);
-	m_sprite.setOrigin(m_radius, m_radius);
-	m_sprite.setFillColor(Color::White);
-	m_sprite.setOutlineColor(Color::Black);
-	m_sprite.setOutlineThickness(2);
+	m_fillColor = Color::White;
+	m_body = nullptr;
 
 	CreateBody();
 }
@@ -36,6 +31,35 @@ DebugCircle::~DebugCircle()
 	//cout << "--BodyCount (DebugCirle)\n";
 }
 
+DebugCircle::DebugCircle(DebugCircle&& other) noexcept
+	: DebugShape(std::move(other))
+	, m_radius(other.m_radius)
+	, m_fillColor(other.m_fillColor)
+	, m_body(other.m_body)
+	, m_world(other.m_world)
+{
+	++DebugCircleCount;
+	other.m_body = nullptr;
+}
+
+DebugCircle& DebugCircle::operator= (DebugCircle&& other) noexcept
+{
+	if (this != &other)
+	{
+		DeleteBody();
+		DebugShape::operator=(std::move(other));
+
+		m_radius = other.m_radius;
+		m_fillColor = other.m_fillColor;
+		m_body = other.m_body;
+		m_world = other.m_world;
+
+		other.m_body = nullptr;
+	}
+
+	return *this;
+}
+
 void DebugCircle::CreateBody()
 {
 	b2BodyDef bodyDef;
@@ -46,8 +70,7 @@ void DebugCircle::CreateBody()
 	bodyDef.allowSleep = true;
 	bodyDef.awake = true;
 
-	if (!m_tag->empty())
-		bodyDef.userData.pointer = reinterpret_cast<uintptr_t>(m_tag);
+	bodyDef.userData = MakeUserData();
 
 	m_body = m_world->CreateBody(&bodyDef);
 
@@ -60,6 +83,8 @@ void DebugCircle::CreateBody()
 	fixtureDef.friction = .7f;
 	fixtureDef.shape = &shape;
 	m_body->CreateFixture(&fixtureDef);
+
+	SavePreviousTransform(m_body);
 }
 
 void DebugCircle::DeleteBody()
@@ -71,10 +96,23 @@ void DebugCircle::DeleteBody()
 	}
 }
 
-void DebugCircle::Update()
+void DebugCircle::SaveTransform()
 {
+	SavePreviousTransform(m_body);
+}
+
+bool DebugCircle::Update(float alpha)
+{
+	// Keep cached geometry while the body sleeps where it was built
+	if (IsResting(m_body))
+		return false;
+
 	if (m_body->GetType() == b2_dynamicBody)
 	{
+		float angle = 0.f;
+		b2Transform transform = GetInterpolatedTransform(m_body, alpha, angle);
+		UNUSED(angle);
+
 		b2Fixture* fixture = m_body->GetFixtureList();
 
 		while (fixture != NULL)
@@ -83,10 +121,8 @@ void DebugCircle::Update()
 			{
 				case b2Shape::e_circle:
 				{
-					m_position.x = m_body->GetPosition().x * SCALE;
-					m_position.y = m_body->GetPosition().y * SCALE;
-					m_sprite.setPosition(m_position);
-					m_sprite.setRotation(m_body->GetAngle() * 180/b2_pi);
+					m_position.x = transform.p.x * SCALE;
+					m_position.y = transform.p.y * SCALE;
 					break;
 				}
 				default:
@@ -96,48 +132,22 @@ void DebugCircle::Update()
 			fixture = fixture->GetNext();
 		}
 	}
-}
 
-void DebugCircle::Draw(RenderWindow& window)
-{
-	window.draw(m_sprite);
+	UpdateRestingState(m_body);
+	return true;
 }
 
-string* DebugCircle::GetUserData()
+void DebugCircle::AppendGeometry(ShapeBatch& batch) const
 {
-	b2BodyUserData data = m_body->GetUserData();
-
-	if (data.pointer != 0)
-	{
-		return reinterpret_cast<string*>(data.pointer);
-	}
-
-	return nullptr;
+	batch.AddCircle(m_position, m_radius, m_fillColor, 2.f, Color::Black);
 }
 
-void DebugCircle::DoTestPoint(const sf::Vector2f& point)
+void DebugCircle::SetHighlighted(bool highlighted)
 {
-	if (m_body->GetType() == b2_dynamicBody)
-	{
-		b2Fixture* fixture = m_body->GetFixtureList();
-
-		if (fixture != NULL)
-		{
-			b2Vec2 scaledPoint(point.x/SCALE, point.y/SCALE);
-
-			if (fixture->TestPoint(scaledPoint))
-			{
-				m_sprite.setFillColor(sf::Color::Red);
-			}
-			else
-			{
-				m_sprite.setFillColor(sf::Color::White);
-			}
-		}
-	}
+	m_fillColor = highlighted ? Color::Red : Color::White;
 }
 
-void DebugCircle::ResetTestPoint()
+b2Body* DebugCircle::GetBody() const
 {
-	m_sprite.setFillColor(Color::White);
+	return m_body;
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "editor/debug/debug_shape.hpp"
 #include "editor/box2d_utils.hpp"
+#include "editor/tag_registry.hpp"
 
 using sf::Vector2f;
 using std::string;
@@ -10,17 +11,61 @@ unsigned int DebugShape::DebugCircleCount = 0;
 unsigned int DebugShape::CustomPolygonCount = 0;
 unsigned int DebugShape::MultiShapeCount = 0;
 
-DebugShape::DebugShape(const Vector2f& position,const string& tag)
+DebugShape::DebugShape(const Vector2f& position, const string& tag,
+	ShapeType type)
 {
 	++ShapeBodyCount;
 	m_markedForDelete = false;
 	m_position = position;
-	m_tag = new string(tag.c_str());
+	m_tagId = TagRegistry::GetInstance()->Register(tag);
+	m_type = type;
+	m_index = 0;
+	m_owner = BodyUserData{ m_tagId, 0, 0 };
+	m_prevBodyPosition.SetZero();
+	m_prevBodyAngle = 0.f;
+	m_restPosition.SetZero();
+	m_restAngle = 0.f;
+	m_geometryAtRest = false;
+}
+
+DebugShape::DebugShape(DebugShape&& other) noexcept
+	: m_position(other.m_position)
+	, m_tagId(other.m_tagId)
+	, m_type(other.m_type)
+	, m_index(other.m_index)
+	, m_owner(other.m_owner)
+	, m_markedForDelete(other.m_markedForDelete)
+	, m_prevBodyPosition(other.m_prevBodyPosition)
+	, m_prevBodyAngle(other.m_prevBodyAngle)
+	, m_restPosition(other.m_restPosition)
+	, m_restAngle(other.m_restAngle)
+	, m_geometryAtRest(other.m_geometryAtRest)
+{
+	++ShapeBodyCount;
+}
+
+DebugShape& DebugShape::operator= (DebugShape&& other) noexcept
+{
+	if (this != &other)
+	{
+		m_position = other.m_position;
+		m_tagId = other.m_tagId;
+		m_type = other.m_type;
+		m_index = other.m_index;
+		m_owner = other.m_owner;
+		m_markedForDelete = other.m_markedForDelete;
+		m_prevBodyPosition = other.m_prevBodyPosition;
+		m_prevBodyAngle = other.m_prevBodyAngle;
+		m_restPosition = other.m_restPosition;
+		m_restAngle = other.m_restAngle;
+		m_geometryAtRest = other.m_geometryAtRest;
+	}
+
+	return *this;
 }
 
 DebugShape::~DebugShape()
 {
-	SafeDelete(m_tag);
 	--ShapeBodyCount;
 }
 
@@ -37,4 +82,102 @@ bool DebugShape::IsMarkedForDelete() const
 Vector2f DebugShape::GetPosition() const
 {
 	return m_position;
+}
+
+TagId DebugShape::GetTagId() const
+{
+	return m_tagId;
+}
+
+const string& DebugShape::GetTag() const
+{
+	return TagRegistry::GetInstance()->GetTag(m_tagId);
+}
+
+ShapeType DebugShape::GetShapeType() const
+{
+	return m_type;
+}
+
+/* Owner as read back from the body, for checking the packed data */
+BodyUserData DebugShape::GetUserData() const
+{
+	BodyUserData owner = {TagRegistry::NO_TAG, 0, 0};
+
+	if (const b2Body* body = GetBody())
+		BodyUserData::Unpack(body->GetUserData(), owner);
+
+	return owner;
+}
+
+const BodyUserData& DebugShape::GetOwner() const
+{
+	return m_owner;
+}
+
+void DebugShape::SetOwner(const BodyUserData& owner)
+{
+	m_owner = owner;
+
+	if (b2Body* body = GetBody())
+		body->GetUserData() = MakeUserData();
+}
+
+std::uint32_t DebugShape::GetIndex() const
+{
+	return m_index;
+}
+
+/* Only the array slot changes, the packed owner stays valid */
+void DebugShape::SetIndex(std::uint32_t index)
+{
+	m_index = index;
+}
+
+b2BodyUserData DebugShape::MakeUserData() const
+{
+	return m_owner.Pack();
+}
+
+/** Caches the body transform before a physics step so the rendered
+ *  transform can be blended between the previous and current state.
+ */
+void DebugShape::SavePreviousTransform(const b2Body* body)
+{
+	m_prevBodyPosition = body->GetPosition();
+	m_prevBodyAngle = body->GetAngle();
+}
+
+/** Returns the body transform interpolated between the cached previous
+ *  state and the current state. The blended angle is also returned.
+ */
+b2Transform DebugShape::GetInterpolatedTransform(const b2Body* body,
+	float alpha, float& angle) const
+{
+	b2Vec2 position = (1.f - alpha) * m_prevBodyPosition + alpha * body->GetPosition();
+	angle = m_prevBodyAngle + alpha * (body->GetAngle() - m_prevBodyAngle);
+
+	return b2Transform(position, b2Rot(angle));
+}
+
+/** True if the body is asleep and still at the pose its cached geometry
+ *  was built from, so the geometry doesn't need recomputing.
+ */
+bool DebugShape::IsResting(const b2Body* body) const
+{
+	return m_geometryAtRest && !body->IsAwake() &&
+		body->GetPosition() == m_restPosition &&
+		body->GetAngle() == m_restAngle;
+}
+
+/** Called after geometry is rebuilt. The geometry is a resting pose once
+ *  the body stopped moving between the last two steps, as interpolation
+ *  then blends two identical transforms.
+ */
+void DebugShape::UpdateRestingState(const b2Body* body)
+{
+	m_restPosition = body->GetPosition();
+	m_restAngle = body->GetAngle();
+	m_geometryAtRest = m_prevBodyPosition == m_restPosition &&
+		m_prevBodyAngle == m_restAngle;
 }
\ No newline at end of file
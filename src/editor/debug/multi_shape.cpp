@@ -3,20 +3,64 @@
 using sf::Vector2f;
 using sf::RenderWindow;
 using sf::Color;
-using std::vector;
 using std::size_t;
 using std::cout;
 
 #include <cstdlib>
 
 MultiShape::MultiShape(const Vector2f& position, b2World* world)
-	: DebugShape(position, "custom_polygon")
+	: DebugShape(position, "multi_shape", ShapeType::MultiShape)
 {
 	++MultiShapeCount;
 
+	m_world = world;
+	m_body = nullptr;
+	m_wireframe = false;
+	m_multipleFixture = true;
+
 	CreateMultipleFixtureBody();
 }
 
+MultiShape::MultiShape(MultiShape&& other) noexcept
+	: DebugShape(std::move(other))
+	, m_wireframe(other.m_wireframe)
+	, m_body(other.m_body)
+	, m_world(other.m_world)
+	, m_shape1(other.m_shape1)
+	, m_shape2(other.m_shape2)
+	, m_worldShape1(other.m_worldShape1)
+	, m_worldShape2(other.m_worldShape2)
+	, m_color1(other.m_color1)
+	, m_color2(other.m_color2)
+	, m_multipleFixture(other.m_multipleFixture)
+{
+	++MultiShapeCount;
+	other.m_body = nullptr;
+}
+
+MultiShape& MultiShape::operator= (MultiShape&& other) noexcept
+{
+	if (this != &other)
+	{
+		DeleteBody();
+		DebugShape::operator=(std::move(other));
+
+		m_wireframe = other.m_wireframe;
+		m_body = other.m_body;
+		m_world = other.m_world;
+		m_shape1 = other.m_shape1;
+		m_shape2 = other.m_shape2;
+		m_worldShape1 = other.m_worldShape1;
+		m_worldShape2 = other.m_worldShape2;
+		m_color1 = other.m_color1;
+		m_color2 = other.m_color2;
+		m_multipleFixture = other.m_multipleFixture;
+
+		other.m_body = nullptr;
+	}
+
+	return *this;
+}
 
 MultiShape::~MultiShape()
 {
@@ -31,6 +75,15 @@ MultiShape::~MultiShape()
 	//cout << "--BodyCount (CustomPolygon)\n";
 }
 
+void MultiShape::DeleteBody()
+{
+	if (m_body != nullptr)
+	{
+		m_world->DestroyBody(m_body);
+		m_body = nullptr;
+	}
+}
+
 void MultiShape::CreateMultipleFixtureBody()
 {
 	m_shape1 = {
@@ -60,14 +113,13 @@ void MultiShape::CreateMultipleFixtureBody()
 	bodyDef.enabled = true;
 	bodyDef.angle = (float)(rand() % 360);
 
-	if (!m_tag->empty())
-		bodyDef.userData.pointer = reinterpret_cast<uintptr_t>(m_tag);
+	bodyDef.userData = MakeUserData();
 
 	m_body = m_world->CreateBody(&bodyDef);
 
 	// Create shape1
 	b2PolygonShape shape1;
-	b2Vec2 scaledShape1[m_shape1.size()];
+	b2Vec2 scaledShape1[4];
 	for (int i = 0; i < 4; ++i) {
 		scaledShape1[i].x = m_shape1[i].x / SCALE;
 		scaledShape1[i].y = m_shape1[i].y / SCALE;
@@ -84,7 +136,7 @@ void MultiShape::CreateMultipleFixtureBody()
 
 	// Create shape2
 	b2PolygonShape shape2;
-	b2Vec2 scaledShape2[m_shape2.size()];
+	b2Vec2 scaledShape2[4];
 	for (int i = 0; i < 4; ++i) {
 		scaledShape2[i].x = m_shape2[i].x / SCALE;
 		scaledShape2[i].y = m_shape2[i].y / SCALE;
@@ -99,39 +151,30 @@ void MultiShape::CreateMultipleFixtureBody()
 	fixtureDef2.restitution = 0;
 	m_body->CreateFixture(&fixtureDef2);
 
+	SavePreviousTransform(m_body);
 
-	// Initialise SFML vertex arrays
-	m_wireframe ? m_va1.setPrimitiveType(sf::LinesStrip) :
-				  m_va1.setPrimitiveType(sf::TriangleFan);
-	m_wireframe ? m_va2.setPrimitiveType(sf::LinesStrip) :
-				  m_va2.setPrimitiveType(sf::TriangleFan);
-
-	m_va1.resize(5);
-	m_va2.resize(5);
-
-	// Vertices for first shape
-	for (int i = 0; i < 4; ++i) {
-		m_va1[i].position = m_shape1[i];
-		m_va1[i].color = Color::Cyan;
-	}
-	m_va1[4].position.x = m_shape1.front().x;
-	m_va1[4].position.y = m_shape1.front().y;
-	m_va1[4].color = Color::Cyan;
 
-	// Vertices for second shape
-	for (int i = 0; i < 4; ++i) {
-		m_va2[i].position = m_shape2[i];
-		m_va2[i].color = Color::Blue;
-	}
+	// Rendered vertices, drawn through the sprite manager's shape batch
+	m_worldShape1 = m_shape1;
+	m_worldShape2 = m_shape2;
+	m_color1 = Color::Cyan;
+	m_color2 = Color::Blue;
+}
 
-	// std::cout << m_shape2.front().x << " " << m_shape2.front().y << "\n";
-	m_va2[4].position.x = m_shape2.front().x;
-	m_va2[4].position.y = m_shape2.front().y;
-	m_va2[4].color = Color::Blue;
+void MultiShape::SaveTransform()
+{
+	SavePreviousTransform(m_body);
 }
 
-void MultiShape::Update()
+bool MultiShape::Update(float alpha)
 {
+	// Keep cached geometry while the body sleeps where it was built
+	if (IsResting(m_body))
+		return false;
+
+	float angle = 0.f;
+	b2Transform transform = GetInterpolatedTransform(m_body, alpha, angle);
+
 	int fixture_index = 0;
 	b2Fixture* fixture = m_body->GetFixtureList();
 
@@ -145,32 +188,24 @@ void MultiShape::Update()
 				b2PolygonShape* shape =
 					dynamic_cast<b2PolygonShape*>(fixture->GetShape());
 
-				// Update SFML vertex array
+				// Update rendered vertices
 				if (fixture_index == 0)
 				{
 					for (size_t i = 0; i < 4; ++i)
 					{
-						b2Vec2 point = m_body->GetWorldPoint(shape->m_vertices[i]);
-						m_va1[i].position = Vector2f(point.x*SCALE, point.y*SCALE);
+						b2Vec2 point = b2Mul(transform, shape->m_vertices[i]);
+						m_worldShape1[i] = Vector2f(point.x*SCALE, point.y*SCALE);
 					}
 
-					b2Vec2 firstPoint = m_body->GetWorldPoint(shape->m_vertices[0]);
-					m_va1[m_shape1.size()].position =
-						Vector2f(firstPoint.x*SCALE, firstPoint.y*SCALE);
-
 					++fixture_index;
 				}
 				else
 				{
 					for (size_t i = 0; i < 4; ++i)
 					{
-						b2Vec2 point = m_body->GetWorldPoint(shape->m_vertices[i]);
-						m_va2[i].position = Vector2f(point.x*SCALE, point.y*SCALE);
+						b2Vec2 point = b2Mul(transform, shape->m_vertices[i]);
+						m_worldShape2[i] = Vector2f(point.x*SCALE, point.y*SCALE);
 					}
-
-					b2Vec2 firstPoint = m_body->GetWorldPoint(shape->m_vertices[0]);
-					m_va2[m_shape2.size()].position =
-						Vector2f(firstPoint.x*SCALE, firstPoint.y*SCALE);
 				}
 			}
 
@@ -180,22 +215,14 @@ void MultiShape::Update()
 
 		fixture = fixture->GetNext();
 	}
+
+	UpdateRestingState(m_body);
+	return true;
 }
 
 void MultiShape::SetWireframe(bool wireframe)
 {
 	m_wireframe = wireframe;
-
-	if (m_wireframe)
-	{
-		m_va1.setPrimitiveType(sf::LineStrip);
-		m_va2.setPrimitiveType(sf::LineStrip);
-	}
-	else
-	{
-		m_va1.setPrimitiveType(sf::TriangleFan);
-		m_va2.setPrimitiveType(sf::TriangleFan);
-	}
 }
 
 Vector2f MultiShape::GetBodyPosition() const
@@ -204,47 +231,32 @@ Vector2f MultiShape::GetBodyPosition() const
 	return Vector2f(pos.x*SCALE, pos.y*SCALE);
 }
 
-void MultiShape::Draw(RenderWindow& window)
+void MultiShape::AppendGeometry(ShapeBatch& batch) const
 {
-	window.draw(m_va2);
-	window.draw(m_va1);
-}
-
-void MultiShape::DoTestPoint(const Vector2f& point)
-{
-	if (m_body->GetType() == b2_dynamicBody)
+	if (m_wireframe)
 	{
-		b2Fixture* fixture = m_body->GetFixtureList();
-
-		while (fixture != NULL)
-		{
-			b2Vec2 scaledPoint(point.x/SCALE, point.y/SCALE);
-
-			if (fixture->TestPoint(scaledPoint))
-			{
-				SetVertexColor(Color::Green);
-			}
-			else
-			{
-				SetVertexColor(Color::Magenta);
-			}
-
-			fixture = fixture->GetNext();
-		}
+		batch.AddLineLoop(m_worldShape2.data(), m_worldShape2.size(), m_color2);
+		batch.AddLineLoop(m_worldShape1.data(), m_worldShape1.size(), m_color1);
+	}
+	else
+	{
+		batch.AddConvexPolygon(m_worldShape2.data(), m_worldShape2.size(), m_color2);
+		batch.AddConvexPolygon(m_worldShape1.data(), m_worldShape1.size(), m_color1);
 	}
 }
 
-
-void MultiShape::ResetTestPoint()
+void MultiShape::SetHighlighted(bool highlighted)
 {
-	SetVertexColor(Color::Magenta);
+	SetVertexColor(highlighted ? Color::Green : Color::Magenta);
 }
 
 void MultiShape::SetVertexColor(const Color& color)
 {
-	for (int i = 0; i < m_shape1.size(); ++i)
-		m_va1[i].color = color;
+	m_color1 = color;
+	m_color2 = color;
+}
 
-	for (int i = 0; i < m_shape2.size(); ++i)
-		m_va2[i].color = color;
+b2Body* MultiShape::GetBody() const
+{
+	return m_body;
 }
\ No newline at end of file
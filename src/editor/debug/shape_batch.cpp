@@ -0,0 +1,205 @@
+#include "editor/debug/shape_batch.hpp"
+#include <array>
+#include <cmath>
+
+using sf::Vector2f;
+using sf::Vertex;
+using sf::Color;
+using sf::RenderTarget;
+using std::size_t;
+
+namespace
+{
+	/* Largest point count a single outlined shape can emit */
+	constexpr size_t MAX_OUTLINE_POINTS = 64;
+
+	/* Unit circle points shared by every batched circle */
+	const std::array<Vector2f, ShapeBatch::CIRCLE_POINT_COUNT>& GetUnitCircle()
+	{
+		static const auto points = []()
+		{
+			std::array<Vector2f, ShapeBatch::CIRCLE_POINT_COUNT> result;
+			const float step = 2.f * 3.141592654f / ShapeBatch::CIRCLE_POINT_COUNT;
+
+			for (size_t i = 0; i < result.size(); ++i)
+			{
+				float angle = i * step - 3.141592654f / 2.f;
+				result[i] = Vector2f(std::cos(angle), std::sin(angle));
+			}
+
+			return result;
+		}();
+
+		return points;
+	}
+
+	Vector2f ComputeNormal(const Vector2f& p1, const Vector2f& p2)
+	{
+		Vector2f normal(p1.y - p2.y, p2.x - p1.x);
+		float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+
+		if (length != 0.f)
+			normal /= length;
+
+		return normal;
+	}
+
+	float DotProduct(const Vector2f& p1, const Vector2f& p2)
+	{
+		return p1.x * p2.x + p1.y * p2.y;
+	}
+}
+
+ShapeBatch::ShapeBatch()
+{}
+
+void ShapeBatch::Clear()
+{
+	m_triangles.clear();
+	m_lines.clear();
+}
+
+/* Triangle fan of a convex polygon, written as a plain triangle list */
+void ShapeBatch::AddConvexPolygon(const Vector2f* points, size_t count,
+	const Color& color)
+{
+	if (count < 3)
+		return;
+
+	for (size_t i = 1; i < count - 1; ++i)
+	{
+		m_triangles.emplace_back(points[0], color);
+		m_triangles.emplace_back(points[i], color);
+		m_triangles.emplace_back(points[i + 1], color);
+	}
+}
+
+/* Outline extruded outwards from the shape edges, like sf::Shape's outline.
+   Each edge becomes a quad (two triangles) mitred with its neighbours. */
+void ShapeBatch::AddOutline(const Vector2f* points, size_t count,
+	float thickness, const Color& color)
+{
+	if (count < 3 || count > MAX_OUTLINE_POINTS || thickness == 0.f)
+		return;
+
+	Vector2f center(0.f, 0.f);
+	for (size_t i = 0; i < count; ++i)
+		center += points[i];
+	center /= static_cast<float>(count);
+
+	std::array<Vector2f, MAX_OUTLINE_POINTS> outer;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const Vector2f& p0 = (i == 0) ? points[count - 1] : points[i - 1];
+		const Vector2f& p1 = points[i];
+		const Vector2f& p2 = points[(i + 1) % count];
+
+		Vector2f n1 = ComputeNormal(p0, p1);
+		Vector2f n2 = ComputeNormal(p1, p2);
+
+		// Make sure the normals point towards the outside of the shape
+		if (DotProduct(n1, center - p1) > 0.f)
+			n1 = -n1;
+		if (DotProduct(n2, center - p1) > 0.f)
+			n2 = -n2;
+
+		float factor = 1.f + DotProduct(n1, n2);
+		Vector2f normal = (n1 + n2) / factor;
+
+		outer[i] = p1 + normal * thickness;
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		size_t next = (i + 1) % count;
+
+		m_triangles.emplace_back(points[i], color);
+		m_triangles.emplace_back(outer[i], color);
+		m_triangles.emplace_back(points[next], color);
+
+		m_triangles.emplace_back(outer[i], color);
+		m_triangles.emplace_back(outer[next], color);
+		m_triangles.emplace_back(points[next], color);
+	}
+}
+
+/* Closed polyline written as a line list */
+void ShapeBatch::AddLineLoop(const Vector2f* points, size_t count,
+	const Color& color)
+{
+	if (count < 2)
+		return;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		m_lines.emplace_back(points[i], color);
+		m_lines.emplace_back(points[(i + 1) % count], color);
+	}
+}
+
+void ShapeBatch::AddLine(const Vector2f& start, const Vector2f& end,
+	const Color& color)
+{
+	m_lines.emplace_back(start, color);
+	m_lines.emplace_back(end, color);
+}
+
+/* Square centred on a point and rotated by an angle in radians */
+void ShapeBatch::AddBox(const Vector2f& center, float size, float angle,
+	const Color& fillColor, float outlineThickness, const Color& outlineColor)
+{
+	const float half = size * .5f;
+	const float c = std::cos(angle);
+	const float s = std::sin(angle);
+
+	const Vector2f corners[4] = {
+		Vector2f(-half, -half),
+		Vector2f( half, -half),
+		Vector2f( half,  half),
+		Vector2f(-half,  half)
+	};
+
+	Vector2f points[4];
+	for (size_t i = 0; i < 4; ++i)
+	{
+		points[i].x = center.x + corners[i].x * c - corners[i].y * s;
+		points[i].y = center.y + corners[i].x * s + corners[i].y * c;
+	}
+
+	AddConvexPolygon(points, 4, fillColor);
+	AddOutline(points, 4, outlineThickness, outlineColor);
+}
+
+void ShapeBatch::AddCircle(const Vector2f& center, float radius,
+	const Color& fillColor, float outlineThickness, const Color& outlineColor)
+{
+	const auto& unitCircle = GetUnitCircle();
+
+	std::array<Vector2f, CIRCLE_POINT_COUNT> points;
+	for (size_t i = 0; i < CIRCLE_POINT_COUNT; ++i)
+		points[i] = center + unitCircle[i] * radius;
+
+	AddConvexPolygon(points.data(), points.size(), fillColor);
+	AddOutline(points.data(), points.size(), outlineThickness, outlineColor);
+}
+
+/* One draw call per non-empty batch; wireframes are drawn on top */
+void ShapeBatch::Draw(RenderTarget& target) const
+{
+	if (!m_triangles.empty())
+		target.draw(m_triangles.data(), m_triangles.size(), sf::Triangles);
+
+	if (!m_lines.empty())
+		target.draw(m_lines.data(), m_lines.size(), sf::Lines);
+}
+
+size_t ShapeBatch::GetTriangleVertexCount() const
+{
+	return m_triangles.size();
+}
+
+size_t ShapeBatch::GetLineVertexCount() const
+{
+	return m_lines.size();
+}
\ No newline at end of file
@@ -1,10 +1,15 @@
 #include "editor/grid.hpp"
+#include "editor/culling.hpp"
 #include "editor/mouse_utils.hpp"
+#include "editor/managers/input_manager.hpp"
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 using std::string;
 using sf::Color;
 using sf::Event;
+using sf::FloatRect;
 using sf::RenderWindow;
 using sf::Vector2f;
 
@@ -12,6 +17,7 @@ Grid::Grid(const Vector2f& resolution, const Vector2f& levelSize)
 	: m_resolution(resolution)
 	, m_levelSize(levelSize)
 	, m_color(Color(194.f, 194.f, 214.f, 96.f))
+	, m_frame(0)
 	, m_type(GridType::STANDARD)
 	, m_unitSize(30.f)
 	, m_crossHairSize(5.f)
@@ -21,7 +27,7 @@ Grid::Grid(const Vector2f& resolution, const Vector2f& levelSize)
 	m_gridHud.setCenter(m_resolution.x * .5f, m_resolution.y * .5f);
 
 	InitLabels();
-	BuildGrid();
+	InvalidateTiles();
 }
 
 Grid::~Grid()
@@ -33,7 +39,7 @@ void Grid::Reset()
 	m_type = GridType::STANDARD;
 	m_unitSize = 30.f;
 	m_visible = true;
-	BuildGrid();
+	InvalidateTiles();
 }
 
 void Grid::InitLabels()
@@ -64,7 +70,7 @@ void Grid::HandleInput(const Event& event, RenderWindow& window)
 	if (event.type == Event::MouseMoved)
 	{
 		// Defined in mouse_utils.cpp
-		SetMouseLabel(m_mouseLabel, window);
+		SetMouseLabel(m_mouseLabel, InputManager::GetInstance()->GetSnapshot().mouseWorld);
 	}
 }
 
@@ -75,8 +81,32 @@ void Grid::Draw(RenderWindow& window)
 {
 	if (m_visible)
 	{
-		// Draw vertex array
-		window.draw(m_vertexArray);
+		// Pick a detail level from the view's on-screen scale
+		const sf::View& view = window.getView();
+		float pixelScale = window.getSize().x / view.getSize().x;
+		int level = GetDetailLevel(pixelScale);
+
+		// Build tiles around the view, then draw the ones actually on screen
+		PrepareTiles(GetViewBounds(view, VIEW_MARGIN), level);
+
+		FloatRect viewBounds = GetViewBounds(view);
+		TileKey first, last;
+
+		if (GetTileRange(viewBounds, level, first, last))
+		{
+			for (int x = first.x; x <= last.x; ++x)
+			{
+				for (int y = first.y; y <= last.y; ++y)
+				{
+					auto it = m_tiles.find(TileKey{ level, x, y });
+					if (it != m_tiles.end() && !it->second.vertices.empty())
+					{
+						window.draw(it->second.vertices.data(),
+							it->second.vertices.size(), sf::Lines);
+					}
+				}
+			}
+		}
 
 		// Draw HUD
 		window.setView(m_gridHud);
@@ -99,7 +129,7 @@ void Grid::SetUnitSize(float size)
 	if (size <= MAX_UNIT_SIZE && size >= MIN_UNIT_SIZE)
 	{
 		m_unitSize = size;
-		BuildGrid();
+		InvalidateTiles();
 	}
 }
 
@@ -113,14 +143,14 @@ void Grid::IncrementUnitSize(float size)
 	if ((m_unitSize + size) <= MAX_UNIT_SIZE && (m_unitSize + size) >= MIN_UNIT_SIZE)
 	{
 		m_unitSize += size;
-		BuildGrid();
+		InvalidateTiles();
 	}
 }
 
 void Grid::SetType(GridType type)
 {
 	m_type = type;
-	BuildGrid();
+	InvalidateTiles();
 }
 
 sf::Color Grid::GetLineColor() const
@@ -128,10 +158,19 @@ sf::Color Grid::GetLineColor() const
 	return m_color;
 }
 
+/* Positions don't depend on colour, so cached tiles are recoloured in place */
 void Grid::SetLineColor(const sf::Color& color)
 {
 	m_color = color;
-	BuildGrid();
+	Color majorColor = GetMajorLineColor();
+
+	for (auto& tile : m_tiles)
+	{
+		auto& vertices = tile.second.vertices;
+
+		for (std::size_t i = 0; i < vertices.size(); ++i)
+			vertices[i].color = i < tile.second.majorCount ? majorColor : m_color;
+	}
 }
 
 void Grid::IsVisible(bool flag)
@@ -144,88 +183,263 @@ bool Grid::IsVisible() const
 	return m_visible;
 }
 
+// --------------------------------------------------------------------------------
+// Tile Methods
+// --------------------------------------------------------------------------------
+
+/* Unit size or type changed, so every cached tile is stale */
+void Grid::InvalidateTiles()
+{
+	m_tiles.clear();
+}
+
+/* World distance between lines at a detail level */
+float Grid::GetLineSpacing(int level) const
+{
+	float spacing = m_unitSize;
+	for (int i = 0; i < level; ++i)
+		spacing *= MAJOR_LINE_EVERY;
+
+	return spacing;
+}
+
+float Grid::GetTileSize(int level) const
+{
+	return TILE_UNITS * GetLineSpacing(level);
+}
+
+/* Major lines use the line colour at double opacity */
+Color Grid::GetMajorLineColor() const
+{
+	Color color = m_color;
+	color.a = static_cast<sf::Uint8>(std::min(255, color.a * 2));
+	return color;
+}
+
+int Grid::GetDetailLevel(float pixelScale) const
+{
+	int level = 0;
+	float spacing = m_unitSize * pixelScale;
+
+	while (spacing < MIN_LINE_SPACING && level < MAX_DETAIL_LEVEL)
+	{
+		spacing *= MAJOR_LINE_EVERY;
+		++level;
+	}
+
+	return level;
+}
+
+/* Tile area clamped to the level */
+FloatRect Grid::GetTileBounds(const TileKey& key) const
+{
+	float tileSize = GetTileSize(key.level);
+	float left = key.x * tileSize;
+	float top  = key.y * tileSize;
+
+	return FloatRect(left, top,
+		std::min(left + tileSize, m_levelSize.x) - left,
+		std::min(top + tileSize, m_levelSize.y) - top);
+}
+
+/* Inclusive range of tiles overlapping an area. Returns false if the
+   area is outside the level. */
+bool Grid::GetTileRange(const FloatRect& area, int level,
+	TileKey& first, TileKey& last) const
+{
+	if (area.left > m_levelSize.x || area.top > m_levelSize.y ||
+		area.left + area.width < 0.f || area.top + area.height < 0.f)
+		return false;
+
+	float spacing = GetLineSpacing(level);
+	float tileSize = GetTileSize(level);
+
+	// Last line index along each axis decides the last tile
+	int lastX = static_cast<int>(m_levelSize.x / spacing) / TILE_UNITS;
+	int lastY = static_cast<int>(m_levelSize.y / spacing) / TILE_UNITS;
+
+	first.level = last.level = level;
+	first.x = std::max(0, static_cast<int>(std::floor(area.left / tileSize)));
+	first.y = std::max(0, static_cast<int>(std::floor(area.top / tileSize)));
+	last.x  = std::min(lastX, static_cast<int>(std::floor((area.left + area.width) / tileSize)));
+	last.y  = std::min(lastY, static_cast<int>(std::floor((area.top + area.height) / tileSize)));
+
+	return first.x <= last.x && first.y <= last.y;
+}
+
+void Grid::PrepareTiles(const FloatRect& area, int level)
+{
+	++m_frame;
+
+	TileKey first, last;
+	if (!GetTileRange(area, level, first, last))
+		return;
+
+	for (int x = first.x; x <= last.x; ++x)
+	{
+		for (int y = first.y; y <= last.y; ++y)
+		{
+			TileKey key{ level, x, y };
+			auto it = m_tiles.find(key);
+
+			if (it == m_tiles.end())
+			{
+				it = m_tiles.emplace(key, GridTile()).first;
+				BuildTile(it->second, key);
+			}
+
+			it->second.lastUsed = m_frame;
+		}
+	}
+
+	EvictTiles();
+}
+
+/* Drops the least recently used tiles once the cache is over budget.
+   Tiles needed this frame are never evicted, and tiles from a detail
+   level that is no longer drawn age out the same way. */
+void Grid::EvictTiles()
+{
+	if (m_tiles.size() <= MAX_CACHED_TILES)
+		return;
+
+	std::vector<std::pair<unsigned int, TileKey>> stale;
+	for (const auto& tile : m_tiles)
+	{
+		if (tile.second.lastUsed != m_frame)
+			stale.emplace_back(tile.second.lastUsed, tile.first);
+	}
+
+	std::sort(stale.begin(), stale.end());
+
+	for (const auto& entry : stale)
+	{
+		if (m_tiles.size() <= MAX_CACHED_TILES)
+			break;
+
+		m_tiles.erase(entry.second);
+	}
+}
+
+std::size_t Grid::GetCachedTileCount() const
+{
+	return m_tiles.size();
+}
+
 // --------------------------------------------------------------------------------
 // Build Methods
 // --------------------------------------------------------------------------------
 
-void Grid::BuildGrid()
+void Grid::BuildTile(GridTile& tile, const TileKey& key) const
 {
+	tile.vertices.clear();
+	tile.majorCount = 0;
+
 	switch (m_type)
 	{
 	case GridType::STANDARD:
-		BuildStandardGrid();
+		BuildStandardTile(tile, key);
 		break;
 
 	case GridType::CROSS_HAIR:
-		BuildCrossHairGrid();
+		BuildCrossHairTile(tile, key);
 		break;
 	}
 }
 
-void Grid::BuildStandardGrid()
+/* A line belongs to the tile its coordinate falls in, so lines on tile
+   borders are only emitted once. Each line spans the tile's extent.
+   Every MAJOR_LINE_EVERY'th line is major; majors are written first. */
+void Grid::BuildStandardTile(GridTile& tile, const TileKey& key) const
 {
-	m_vertexArray.clear();
-	m_vertexArray.setPrimitiveType(sf::Lines);
+	FloatRect bounds = GetTileBounds(key);
+	float spacing = GetLineSpacing(key.level);
 
-	uint pointsX = (m_levelSize.x / m_unitSize) + 1;
-	uint pointsY = (m_levelSize.y / m_unitSize) + 1;
+	int firstX = key.x * TILE_UNITS;
+	int firstY = key.y * TILE_UNITS;
+	int lastX = std::min(firstX + TILE_UNITS - 1, static_cast<int>(m_levelSize.x / spacing));
+	int lastY = std::min(firstY + TILE_UNITS - 1, static_cast<int>(m_levelSize.y / spacing));
 
-	m_vertexArray.resize((pointsX * 2) + (pointsY * 2));
+	float right  = bounds.left + bounds.width;
+	float bottom = bounds.top + bounds.height;
 
-	uint i = 0;
-	for (uint x = 0; x < pointsX; ++x)
-	{
-		Vector2f position(x * m_unitSize, 0.f);
-		m_vertexArray[i].position = position;
-		m_vertexArray[i++].color = m_color;
+	tile.vertices.reserve(((lastX - firstX + 1) + (lastY - firstY + 1)) * 2);
 
-		position.y = m_levelSize.y;
+	Color majorColor = GetMajorLineColor();
 
-		m_vertexArray[i].position = position;
-		m_vertexArray[i++].color = m_color;
-	}
-
-	for (uint y = 0; y < pointsY; ++y)
+	for (int pass = 0; pass < 2; ++pass)
 	{
-		Vector2f position(0.f, y*m_unitSize);
-		m_vertexArray[i].position = position;
-		m_vertexArray[i++].color = m_color;
+		bool majorPass = (pass == 0);
+		Color color = majorPass ? majorColor : m_color;
 
-		position.x = m_levelSize.x;
+		if (bounds.height > 0.f)
+		{
+			for (int x = firstX; x <= lastX; ++x)
+			{
+				if ((x % MAJOR_LINE_EVERY == 0) != majorPass)
+					continue;
+
+				tile.vertices.emplace_back(Vector2f(x * spacing, bounds.top), color);
+				tile.vertices.emplace_back(Vector2f(x * spacing, bottom), color);
+			}
+		}
 
-		m_vertexArray[i].position = position;
-		m_vertexArray[i++].color = m_color;
+		if (bounds.width > 0.f)
+		{
+			for (int y = firstY; y <= lastY; ++y)
+			{
+				if ((y % MAJOR_LINE_EVERY == 0) != majorPass)
+					continue;
+
+				tile.vertices.emplace_back(Vector2f(bounds.left, y * spacing), color);
+				tile.vertices.emplace_back(Vector2f(right, y * spacing), color);
+			}
+		}
+
+		if (majorPass)
+			tile.majorCount = tile.vertices.size();
 	}
 }
 
-void Grid::BuildCrossHairGrid()
+/* Cross hairs scale with the line spacing so they keep the same size on
+   screen at every detail level. A point is major when it lies on both a
+   major column and a major row. */
+void Grid::BuildCrossHairTile(GridTile& tile, const TileKey& key) const
 {
-	m_vertexArray.clear();
-	m_vertexArray.setPrimitiveType(sf::Lines);
-
-	uint pointsX = (m_levelSize.x / m_unitSize) + 1;
-	uint pointsY = (m_levelSize.y / m_unitSize) + 1;
+	float spacing = GetLineSpacing(key.level);
 
-	m_vertexArray.resize((pointsX * pointsY) * 4);
+	int firstX = key.x * TILE_UNITS;
+	int firstY = key.y * TILE_UNITS;
+	int lastX = std::min(firstX + TILE_UNITS - 1, static_cast<int>(m_levelSize.x / spacing));
+	int lastY = std::min(firstY + TILE_UNITS - 1, static_cast<int>(m_levelSize.y / spacing));
 
-	float l = m_crossHairSize;
-	uint i = 0;
-	for (uint x = 0; x < pointsX; ++x)
-	{
-		for (uint y = 0; y < pointsY; ++y)
-		{
-			Vector2f p(x*m_unitSize, y*m_unitSize);
-			m_vertexArray[i].position = Vector2f(p.x-l, p.y);
-			m_vertexArray[i++].color = m_color;
+	tile.vertices.reserve((lastX - firstX + 1) * (lastY - firstY + 1) * 4);
 
-			m_vertexArray[i].position = Vector2f(p.x+l, p.y);
-			m_vertexArray[i++].color = m_color;
+	Color majorColor = GetMajorLineColor();
+	float l = m_crossHairSize * (spacing / m_unitSize);
 
-			m_vertexArray[i].position = Vector2f(p.x, p.y-l);
-			m_vertexArray[i++].color = m_color;
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		bool majorPass = (pass == 0);
+		Color color = majorPass ? majorColor : m_color;
 
-			m_vertexArray[i].position = Vector2f(p.x, p.y+l);
-			m_vertexArray[i++].color = m_color;
+		for (int x = firstX; x <= lastX; ++x)
+		{
+			for (int y = firstY; y <= lastY; ++y)
+			{
+				bool major = (x % MAJOR_LINE_EVERY == 0) && (y % MAJOR_LINE_EVERY == 0);
+				if (major != majorPass)
+					continue;
+
+				Vector2f p(x*spacing, y*spacing);
+				tile.vertices.emplace_back(Vector2f(p.x-l, p.y), color);
+				tile.vertices.emplace_back(Vector2f(p.x+l, p.y), color);
+				tile.vertices.emplace_back(Vector2f(p.x, p.y-l), color);
+				tile.vertices.emplace_back(Vector2f(p.x, p.y+l), color);
+			}
 		}
+
+		if (majorPass)
+			tile.majorCount = tile.vertices.size();
 	}
 }
\ No newline at end of file
@@ -1,4 +1,7 @@
 #include "editor/managers/camera_manager.hpp"
+#include "editor/managers/input_manager.hpp"
+#include "imgui.h"
+#include <cmath>
 
 CameraManager::CameraManager()
 {
@@ -20,8 +23,25 @@ CameraManager::CameraManager()
 CameraManager::~CameraManager()
 {}
 
-void CameraManager::HandleInput(const sf::Event& event)
+void CameraManager::HandleInput(const sf::Event& event, const sf::RenderWindow& window)
 {
+	// Mouse wheel: zoom about the cursor, unless it's over an ImGui window
+	if (event.type == sf::Event::MouseWheelScrolled &&
+		event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel &&
+		!ImGui::GetIO().WantCaptureMouse)
+	{
+		sf::Vector2i pixel(event.mouseWheelScroll.x, event.mouseWheelScroll.y);
+		sf::Vector2f before = window.mapPixelToCoords(pixel, m_view);
+
+		m_camera->SetZoom(m_camera->GetZoom() *
+			std::pow(ZOOM_STEP, -event.mouseWheelScroll.delta));
+		m_view.setSize(EditorSettings::RESOLUTION * m_camera->GetZoom());
+
+		// Keep the point under the cursor fixed
+		sf::Vector2f after = window.mapPixelToCoords(pixel, m_view);
+		m_cameraTarget += before - after;
+	}
+
 	// Mouse Button Pressed
 	if (event.type == sf::Event::MouseButtonPressed)
 	{
@@ -62,7 +82,7 @@ void CameraManager::Update(sf::RenderWindow& window, sf::Time& dt)
 	// every frame.
 	// The following solution updates the current mouse position WITH THE INCREMENT
 	// value BEFORE copying it over to the previous frame mouse position.
-	sf::Vector2f mousePos = GetMousePosition(window);
+	sf::Vector2f mousePos = InputManager::GetInstance()->GetSnapshot().mouseWorld;
 
 	if (m_panCamera)
 	{
@@ -102,7 +122,8 @@ void CameraManager::Update(sf::RenderWindow& window, sf::Time& dt)
 	/** Update camera */
 	m_camera->Update(dt.asSeconds(), m_cameraTarget);
 
-	/* Sync center of view with camera position */
+	/* Sync view with camera position and zoom */
+	m_view.setSize(EditorSettings::RESOLUTION * m_camera->GetZoom());
 	m_view.setCenter(m_camera->GetPosition());
 }
 
@@ -1,4 +1,6 @@
 #include "editor/managers/edge_chain_manager.hpp"
+#include "editor/culling.hpp"
+#include "editor/managers/input_manager.hpp"
 
 EdgeChainManager::EdgeChainManager(b2World* world)
 {
@@ -35,11 +37,12 @@ EdgeChainManager::~EdgeChainManager()
 
 void EdgeChainManager::CheckChainClicked(sf::RenderWindow& window)
 {
+	const sf::Vector2f m = InputManager::GetInstance()->GetSnapshot().mouseWorld;
+
 	for (int i = 0; i < m_chains.size(); ++i)
 	{
 		auto& chain = m_chains[i];
 		sf::FloatRect r = chain.GetMoveHandleLabelRect();
-		sf::Vector2f  m = GetMousePosition(window);
 
 		if ((m.x > r.left && m.x < r.left + r.width) &&
 			(m.y > r.top && m.y < r.top + r.height))
@@ -68,6 +71,13 @@ void EdgeChainManager::SelectCurrentChain()
 
 /* Create a new StaticEdgeChain object */
 void EdgeChainManager::PushChain(const Vector2f& startPos)
+{
+	PushChain(demo_data::newChainCoords, startPos);
+}
+
+/* Create a new StaticEdgeChain object from custom vertices */
+void EdgeChainManager::PushChain(std::vector<Vector2f>& vertices,
+	const Vector2f& startPos)
 {
 	// Generate a unique label for the new chain
 	unsigned int n = m_chains.size() + 1;
@@ -78,11 +88,11 @@ void EdgeChainManager::PushChain(const Vector2f& startPos)
 	}
 
 	m_chains.push_back(StaticEdgeChain(
-		demo_data::newChainCoords, startPos, tag, m_world, this));
+		vertices, startPos, tag, m_world, this));
 
 	m_guiLabels.push_back(tag);
 	++m_edgeChainCount;
-	m_edgeChainVertexCount += demo_data::newChainCoords.size();
+	m_edgeChainVertexCount += vertices.size();
 
 	m_currSelectedIndex = m_chains.size()-1;
 	SelectCurrentChain();
@@ -148,6 +158,9 @@ void EdgeChainManager::Update(sf::RenderWindow& window)
 
 void EdgeChainManager::Draw(sf::RenderWindow& window)
 {
+	// A handful of chains, so a rectangle test each is enough
+	sf::FloatRect visibleArea = GetViewBounds(window.getView());
+
 	for (auto& chain : m_chains)
 	{
 		if (chain.IsEditable())
@@ -155,6 +168,9 @@ void EdgeChainManager::Draw(sf::RenderWindow& window)
 			chain.DrawBoundingBox(m_guiDrawBB);
 		}
 
+		if (!visibleArea.intersects(chain.GetDrawBounds()))
+			continue;
+
 		chain.Draw(window);
 	}
 }
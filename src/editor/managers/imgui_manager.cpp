@@ -1,5 +1,6 @@
 #include "editor/managers/imgui_manager.hpp"
 #include "imgui/imgui_utils.hpp"
+#include "editor/profiler/frame_profiler.hpp"
 
 using std::vector;
 using std::string;
@@ -29,6 +30,11 @@ bool  ImGuiManager::show_camera_settings = true;
 bool  ImGuiManager::enable_clamp         = true;
 float ImGuiManager::tween_duration       = .5f;
 int   ImGuiManager::combo_index          = 1;
+float ImGuiManager::camera_zoom          = 1.f;
+
+/** Profiler settings */
+bool  ImGuiManager::show_profiler        = false;
+float ImGuiManager::trace_seconds        = 5.f;
 
 ImGuiManager::ImGuiManager(RenderWindow& window,
 	shared_ptr<EdgeChainManager> edgeChainManager,
@@ -59,7 +65,7 @@ ImGuiManager::ImGuiManager(RenderWindow& window,
 	InitEasingLabels(easing_labels);
 }
 
-void ImGuiManager::ProcessEvent(sf::Event& event)
+void ImGuiManager::ProcessEvent(const sf::Event& event)
 {
 	ImGui::SFML::ProcessEvent(event);
 
@@ -69,7 +75,7 @@ void ImGuiManager::ProcessEvent(sf::Event& event)
 		if (event.key.code == Keyboard::Space)
 		{
 			int mode = (static_cast<int>(EditorSettings::mode) + 1);
-			if (mode > 3)
+			if (mode > 4)
 			{
 				EditorSettings::mode = RMBMode::PanCameraMode;
 				mode_index = 1;
@@ -91,6 +97,7 @@ void ImGuiManager::Update(RenderWindow& window, Time& dt)
 	UpdateMainWindow();
 	UpdateGridWindow();
 	UpdateCameraWindow();
+	UpdateProfilerWindow();
 	ImGui::End();
 }
 
@@ -178,7 +185,7 @@ void ImGuiManager::UpdateCameraWindow()
 		else
 		{
 			ImGui::Separator();
-			ImGui::SetWindowSize(ImVec2(300.f, 190.f));
+			ImGui::SetWindowSize(ImVec2(300.f, 220.f));
 
 			if (ImGui::FullWidthLabelCheckox("Clamp to Level Size",
 				"##CameraClamping", "If enabled, the camera will not scroll past the level size", &enable_clamp)) {
@@ -201,6 +208,16 @@ void ImGuiManager::UpdateCameraWindow()
 				p_camera->SetDuration(tween_duration);
 			}
 
+			// Mouse wheel zoom also changes this, so read it back every frame
+			camera_zoom = p_camera->GetZoom();
+			ImGui::AlignTextToFramePadding();
+			ImGui::Text("Zoom"); ImGui::SameLine();
+			ImGui::HelpMarker("Visible area relative to the window. Scroll the mouse wheel over the level to zoom about the cursor.");
+			ImGui::SetNextItemWidth(-1);
+			if (ImGui::SliderFloat("##CameraZoom", &camera_zoom, Camera::MIN_ZOOM, Camera::MAX_ZOOM, "%.2fx")) {
+				p_camera->SetZoom(camera_zoom);
+			}
+
 			// Reset grid settings
 			float width = ImGui::GetWindowContentRegionWidth();
 			if (ImGui::StartColorButton(31, 4, "Reset Settings", width, 30.f, false)) {
@@ -212,6 +229,8 @@ void ImGuiManager::UpdateCameraWindow()
 
 				combo_index = static_cast<int>(InterpFunc::ExpoEaseOut);
 				p_camera->SetInterpolation(InterpFunc::ExpoEaseOut);
+
+				p_camera->SetZoom(1.f);
 			}
 			ImGui::StopColorButton();
 			ImGui::Separator();
@@ -220,6 +239,191 @@ void ImGuiManager::UpdateCameraWindow()
 	}
 }
 
+/** Profiler Panel
+*/
+void ImGuiManager::UpdateProfilerWindow()
+{
+	if (show_profiler)
+	{
+		if (!ImGui::Begin("Profiler", &show_profiler)) {
+			ImGui::End();
+		}
+		else
+		{
+			static const ImU32 scopeColors[FrameProfiler::SCOPE_COUNT] = {
+				IM_COL32(141, 211, 199, 255),	// Poll Events
+				IM_COL32(255, 255, 179, 255),	// ImGui Update
+				IM_COL32(190, 186, 218, 255),	// Camera Update
+				IM_COL32(251, 128, 114, 255),	// World Step
+				IM_COL32(128, 177, 211, 255),	// Edge Chain Update
+				IM_COL32(253, 180,  98, 255),	// Sprite Update
+				IM_COL32(179, 222, 105, 255),	// Draw Grid
+				IM_COL32(252, 205, 229, 255),	// Draw Triggers
+				IM_COL32(188, 128, 189, 255),	// Draw Sprites
+				IM_COL32(204, 235, 197, 255),	// Draw Edge Chains
+				IM_COL32(255, 237, 111, 255),	// Draw ImGui
+				IM_COL32(217, 217, 217, 255)	// Display
+			};
+
+			auto profiler = FrameProfiler::GetInstance();
+			size_t sampleCount = profiler->GetSampleCount();
+
+			ImGui::SetWindowSize(ImVec2(420.f, 560.f), ImGuiCond_FirstUseEver);
+			ImGui::Separator();
+			ImGui::FullWidthLabelCheckox("Pause", "##ProfilerPause",
+				"Stop recording frames to inspect the history.", profiler->GetPausedFlag());
+
+			/* Frame time percentiles */
+			ImVec4 lightBlue(.6f, .8f, 1.f, 1.f);
+			float p50, p95, p99;
+			profiler->GetFrameTimePercentiles(p50, p95, p99);
+			FrameSample average = profiler->GetAverageSample();
+
+			ImGui::Separator();
+			ImGui::Text("Frame (ms):"); ImGui::SameLine();
+			ImGui::TextColored(lightBlue, "avg %.2f  p50 %.2f  p95 %.2f  p99 %.2f",
+				average.frameTime, p50, p95, p99);
+
+			/* Stacked frame time graph, newest frame on the right */
+			float graphWidth = ImGui::GetWindowContentRegionWidth();
+			float graphHeight = 120.f;
+
+			float maxTime = 1000.f / 60.f;
+			for (size_t i = 0; i < sampleCount; ++i)
+				maxTime = std::max(maxTime, profiler->GetSample(i).frameTime);
+
+			ImDrawList* drawList = ImGui::GetWindowDrawList();
+			ImVec2 origin = ImGui::GetCursorScreenPos();
+			ImVec2 corner(origin.x + graphWidth, origin.y + graphHeight);
+
+			drawList->AddRectFilled(origin, corner, IM_COL32(30, 30, 30, 255));
+
+			float barWidth = graphWidth / FrameProfiler::HISTORY_SIZE;
+			float pixelsPerMs = graphHeight / maxTime;
+
+			for (size_t age = 0; age < sampleCount; ++age)
+			{
+				const FrameSample& sample = profiler->GetSample(age);
+				float x1 = corner.x - age * barWidth;
+				float x0 = x1 - barWidth;
+				float y = corner.y;
+
+				for (size_t s = 0; s < FrameProfiler::SCOPE_COUNT; ++s)
+				{
+					float h = sample.scopes[s] * pixelsPerMs;
+					if (h <= 0.f)
+						continue;
+
+					drawList->AddRectFilled(ImVec2(x0, y - h), ImVec2(x1, y), scopeColors[s]);
+					y -= h;
+				}
+			}
+
+			// 60 fps budget line
+			float budgetY = corner.y - (1000.f / 60.f) * pixelsPerMs;
+			drawList->AddLine(ImVec2(origin.x, budgetY), ImVec2(corner.x, budgetY),
+				IM_COL32(255, 80, 80, 160));
+
+			ImGui::Dummy(ImVec2(graphWidth, graphHeight));
+
+			/* Per scope averages (doubles as the graph legend) */
+			ImGui::Separator();
+			ImGui::SetNextTreeNodeOpen(true, ImGuiTreeNodeFlags_DefaultOpen);
+			if (ImGui::TreeNode("Scopes (avg ms)"))
+			{
+				for (size_t s = 0; s < FrameProfiler::SCOPE_COUNT; ++s)
+				{
+					ImVec2 pos = ImGui::GetCursorScreenPos();
+					float size = ImGui::GetTextLineHeight();
+					drawList->AddRectFilled(pos, ImVec2(pos.x + size, pos.y + size), scopeColors[s]);
+					ImGui::Dummy(ImVec2(size, size));
+
+					ImGui::SameLine();
+					ImGui::Text("%-18s", FrameProfiler::GetScopeName(static_cast<ProfileScope>(s)));
+					ImGui::SameLine();
+					ImGui::TextColored(lightBlue, "%.3f", average.scopes[s]);
+				}
+				ImGui::TreePop();
+			}
+
+			/* Box2D's own breakdown (b2World::GetProfile), summed per frame */
+			ImGui::Separator();
+			ImGui::SetNextTreeNodeOpen(true, ImGuiTreeNodeFlags_DefaultOpen);
+			if (ImGui::TreeNode("Box2D (avg ms)"))
+			{
+				ImGui::SameLine();
+				ImGui::HelpMarker("b2World::GetProfile() summed over every step taken in a frame.");
+
+				const WorldProfile& world = average.world;
+				float steps = sampleCount > 0 ? (float)world.stepCount / sampleCount : 0.f;
+				float events = sampleCount > 0 ? (float)world.contactEvents / sampleCount : 0.f;
+				float impacts = sampleCount > 0 ? (float)world.impacts / sampleCount : 0.f;
+				float cues = sampleCount > 0 ? (float)world.impactCues / sampleCount : 0.f;
+
+				ImGui::Text("Step:          "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.step);
+				ImGui::Text("Collide:       "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.collide);
+				ImGui::Text("Solve:         "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.solve);
+				ImGui::Text("  Init:        "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.solveInit);
+				ImGui::Text("  Velocity:    "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.solveVelocity);
+				ImGui::Text("  Position:    "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.solvePosition);
+				ImGui::Text("Solve TOI:     "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.solveTOI);
+				ImGui::Text("Broadphase:    "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.3f", world.broadphase);
+				ImGui::Text("Steps / Frame: "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.2f", steps);
+				ImGui::Text("Contact Events / Frame:"); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.1f", events);
+				ImGui::Text("Impacts / Frame:       "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.1f", impacts);
+				ImGui::Text("Impact Cues / Frame:   "); ImGui::SameLine(); ImGui::TextColored(lightBlue, "%.1f", cues);
+				ImGui::TreePop();
+			}
+
+			/* Chrome trace export */
+			ImGui::Separator();
+			ImGui::SetNextTreeNodeOpen(true, ImGuiTreeNodeFlags_DefaultOpen);
+			if (ImGui::TreeNode("Trace Export"))
+			{
+				ImGui::SameLine();
+				ImGui::HelpMarker("Record timer events to a Chrome trace JSON file "
+					"(open in chrome://tracing or Perfetto). Hotkey: T");
+
+				TraceRecorder& trace = profiler->GetTraceRecorder();
+
+				ImGui::AlignTextToFramePadding();
+				ImGui::Text("Duration");
+				ImGui::SameLine();
+				ImGui::SetNextItemWidth(-1);
+				ImGui::SliderFloat("##TraceSeconds", &trace_seconds, 1.f, 30.f, "%.0f secs");
+
+				if (trace.IsRecording() || trace.IsWriting())
+				{
+					ImGui::ProgressBar(trace.GetProgress(), ImVec2(-1, 0),
+						trace.IsRecording() ? "Recording..." : "Writing...");
+				}
+				else
+				{
+					float width = ImGui::GetWindowContentRegionWidth();
+					if (ImGui::StartColorButton(44, 0, "Record Trace", width, 30.f, false))
+						profiler->StartTrace(trace_seconds);
+					ImGui::StopColorButton();
+				}
+
+				if (!trace.GetPath().empty())
+				{
+					ImGui::Text("File:");
+					ImGui::SameLine();
+					ImGui::TextColored(lightBlue, "%s", trace.GetPath().c_str());
+					ImGui::Text("Dropped events:");
+					ImGui::SameLine();
+					ImGui::TextColored(lightBlue, "%llu",
+						(unsigned long long)trace.GetDroppedCount());
+				}
+				ImGui::TreePop();
+			}
+
+			ImGui::Separator();
+			ImGui::End();
+		}
+	}
+}
+
 /** Main Window
 */
 void ImGuiManager::UpdateMainWindow()
@@ -239,6 +443,10 @@ void ImGuiManager::UpdateMainWindow()
 		ImGui::SameLine();
 		if (ImGui::RadioButton("Test Point", &mode_index, 3))
 			EditorSettings::mode = RMBMode::TestPointMode;
+
+		ImGui::SameLine();
+		if (ImGui::RadioButton("Ray Cast", &mode_index, 4))
+			EditorSettings::mode = RMBMode::RayCastMode;
 		ImGui::Separator();
 
 		// Grid Options (blue)
@@ -251,6 +459,11 @@ void ImGuiManager::UpdateMainWindow()
 		if (ImGui::StartColorButton(42, 4, "Camera Settings", width/2, 30.f, true))
 			show_camera_settings = !show_camera_settings;
 		ImGui::StopColorButton();
+
+		// Profiler (blue)
+		if (ImGui::StartColorButton(43, 4, "Profiler", width+6.f, 30.f, false))
+			show_profiler = !show_profiler;
+		ImGui::StopColorButton();
 		ImGui::Separator();
 	}
 
@@ -316,6 +529,18 @@ void ImGuiManager::UpdateMainWindow()
 
 			ImGui::SameLine();
 			ImGui::TextColored(lightBlue, "%d", SpriteManager::DynamicBodiesCount);
+
+			ImGui::Text("Active Bodies: ");
+			ImGui::SameLine();
+			ImGui::TextColored(lightBlue, "%u", p_spriteManager->GetActiveShapeCount());
+			ImGui::SameLine();
+			ImGui::HelpMarker("Shapes whose geometry was rebuilt this frame. Sleeping bodies keep their cached geometry.");
+
+			ImGui::Text("Visible Bodies:");
+			ImGui::SameLine();
+			ImGui::TextColored(lightBlue, "%u", p_spriteManager->GetVisibleShapeCount());
+			ImGui::SameLine();
+			ImGui::HelpMarker("Shapes inside the camera view. Shapes off screen are culled before drawing.");
 			ImGui::TreePop();
 		}
 
@@ -445,6 +670,11 @@ bool ImGuiManager::RenderMouseCoords()
 	return render_mouse_coords;
 }
 
+float ImGuiManager::GetTraceSeconds()
+{
+	return trace_seconds;
+}
+
 void ImGuiManager::InitEasingLabels(std::vector<std::string>& vec) {
 	vec = {
 		"Linear",
@@ -0,0 +1,76 @@
+#include "editor/managers/input_manager.hpp"
+
+using sf::Event;
+using sf::Mouse;
+using sf::RenderWindow;
+using std::shared_ptr;
+using std::size_t;
+
+shared_ptr<InputManager> InputManager::m_instance;
+
+InputManager::InputManager()
+	: m_snapshot()
+	, m_rawEventCount(0)
+{
+	m_events.reserve(64);
+}
+
+shared_ptr<InputManager> InputManager::GetInstance()
+{
+	if (m_instance.get() == nullptr)
+		m_instance.reset(new InputManager);
+
+	return m_instance;
+}
+
+void InputManager::Poll(RenderWindow& window)
+{
+	m_events.clear();
+	m_rawEventCount = 0;
+	m_snapshot.mouseMoved = false;
+
+	Event event;
+	while (window.pollEvent(event))
+	{
+		++m_rawEventCount;
+
+		if (event.type == Event::MouseMoved)
+		{
+			m_snapshot.mouseMoved = true;
+
+			// Only the latest position of a run of moves matters
+			if (!m_events.empty() && m_events.back().type == Event::MouseMoved)
+			{
+				m_events.back() = event;
+				continue;
+			}
+		}
+
+		m_events.push_back(event);
+	}
+
+	/* Sample the mouse once for the whole frame */
+	m_snapshot.mousePixel = Mouse::getPosition(window);
+	m_snapshot.mouseWorld = window.mapPixelToCoords(m_snapshot.mousePixel, window.getView());
+	++m_snapshot.frame;
+}
+
+const std::vector<Event>& InputManager::GetEvents() const
+{
+	return m_events;
+}
+
+const InputSnapshot& InputManager::GetSnapshot() const
+{
+	return m_snapshot;
+}
+
+size_t InputManager::GetRawEventCount() const
+{
+	return m_rawEventCount;
+}
+
+size_t InputManager::GetMergedEventCount() const
+{
+	return m_rawEventCount - m_events.size();
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "editor/managers/sprite_manager.hpp"
 #include "editor/constants.hpp"
+#include "editor/culling.hpp"
+#include "editor/managers/input_manager.hpp"
 
 using sf::Vector2f;
 using sf::Event;
@@ -9,13 +11,170 @@ using sf::RenderWindow;
 
 unsigned int SpriteManager::DynamicBodiesCount = 0;
 
+namespace
+{
+	/* Collects the packed owners of shapes whose fixtures overlap the
+	   query AABB. Static bodies have no owner and are skipped. */
+	class VisibleShapeCallback : public b2QueryCallback
+	{
+	private:
+		std::vector<uintptr_t>& m_owners;
+
+	public:
+		VisibleShapeCallback(std::vector<uintptr_t>& owners)
+			: m_owners(owners)
+		{}
+
+		bool ReportFixture(b2Fixture* fixture) override
+		{
+			uintptr_t owner = fixture->GetBody()->GetUserData().pointer;
+
+			if (owner != 0)
+				m_owners.push_back(owner);
+
+			return true;
+		}
+	};
+
+	/* Collects the packed owners of dynamic shapes containing a point.
+	   The broadphase narrows the search to fixtures whose AABB holds the
+	   point, so only those run the exact test. */
+	class PickShapeCallback : public b2QueryCallback
+	{
+	private:
+		std::vector<uintptr_t>& m_owners;
+		b2Vec2					m_point;
+
+	public:
+		PickShapeCallback(std::vector<uintptr_t>& owners, const b2Vec2& point)
+			: m_owners(owners)
+			, m_point(point)
+		{}
+
+		bool ReportFixture(b2Fixture* fixture) override
+		{
+			const b2Body* body = fixture->GetBody();
+			uintptr_t owner = body->GetUserData().pointer;
+
+			if (owner != 0 && body->GetType() == b2_dynamicBody &&
+				fixture->TestPoint(m_point))
+			{
+				m_owners.push_back(owner);
+			}
+
+			return true;
+		}
+	};
+
+	/* True when a shape has fallen outside the level bounds */
+	bool IsOutsideLevel(const Vector2f& pos)
+	{
+		const float offset = 50.f;
+		const float levelWidth = (float)EditorSettings::levelSize.x;
+		const float levelHeight = (float)EditorSettings::levelSize.y;
+
+		return pos.x < 0.f || pos.x > (levelWidth + offset) ||
+			   pos.y < 0.f || pos.y > (levelHeight + offset);
+	}
+}
+
+/* Appends a shape and gives it an owner slot for its lifetime. Nothing is
+   spawned once every owner slot is taken. */
+template <typename T, typename... Args>
+void SpriteManager::EmplaceShape(std::vector<T>& shapes, Args&&... args)
+{
+	std::uint32_t slot;
+
+	if (!m_freeOwners.empty())
+	{
+		slot = m_freeOwners.back();
+		m_freeOwners.pop_back();
+	}
+	else if (m_owners.size() <= BodyUserData::MAX_SLOT)
+	{
+		slot = static_cast<std::uint32_t>(m_owners.size());
+		m_owners.push_back(OwnerSlot{ ShapeType::DebugBox, 0, 1 });
+	}
+	else
+		return;
+
+	shapes.emplace_back(std::forward<Args>(args)...);
+	T& shape = shapes.back();
+	shape.SetIndex(static_cast<std::uint32_t>(shapes.size() - 1));
+
+	OwnerSlot& owner = m_owners[slot];
+	owner.type = shape.GetShapeType();
+	owner.index = shape.GetIndex();
+	shape.SetOwner(BodyUserData{ shape.GetTagId(), slot, owner.generation });
+
+	++DynamicBodiesCount;
+}
+
+/* Swap-and-pop removal. Draw order within a type array is not
+   significant, so a deleted slot is filled from the back, and the
+   moved shape's owner slot is pointed at its new position. */
+// Returns the number of shapes removed
+template <typename T>
+std::size_t SpriteManager::RemoveMarkedShapes(std::vector<T>& shapes)
+{
+	std::size_t removed = 0;
+	std::size_t i = 0;
+
+	while (i < shapes.size())
+	{
+		if (shapes[i].IsMarkedForDelete())
+		{
+			ReleaseOwner(shapes[i]);
+
+			if (i != shapes.size() - 1)
+			{
+				shapes[i] = std::move(shapes.back());
+				shapes[i].SetIndex(static_cast<std::uint32_t>(i));
+				m_owners[shapes[i].GetOwner().slot].index = static_cast<std::uint32_t>(i);
+			}
+
+			shapes.pop_back();
+			--DynamicBodiesCount;
+			++removed;
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	return removed;
+}
+
+/* Bumps the slot's generation so packed owners of the shape go stale */
+void SpriteManager::ReleaseOwner(const DebugShape& shape)
+{
+	std::uint32_t slot = shape.GetOwner().slot;
+
+	if (slot >= m_owners.size() || m_owners[slot].generation != shape.GetOwner().generation)
+		return;
+
+	m_owners[slot].generation = BodyUserData::NextGeneration(m_owners[slot].generation);
+	m_freeOwners.push_back(slot);
+}
+
 SpriteManager::SpriteManager(b2World* world)
 {
 	m_world = world;
 	//m_resolution = resolution;
 	m_destroyFlag = false;
+	m_activeShapeCount = 0;
+	m_visibleShapeCount = 0;
 	m_wireframeMode = false;
 	m_rmbPressed = false;
+	m_rayCasting = false;
+
+	m_visibleOwners.reserve(RESERVED_SHAPES);
+	m_boxes.reserve(RESERVED_SHAPES);
+	m_circles.reserve(RESERVED_SHAPES);
+	m_polygons.reserve(RESERVED_SHAPES);
+	m_multiShapes.reserve(RESERVED_SHAPES);
+	m_owners.reserve(RESERVED_SHAPES * 4);
 }
 
 SpriteManager::~SpriteManager()
@@ -28,27 +187,17 @@ void SpriteManager::PushShape(const ShapeType type, const Vector2f& position)
 	switch (type)
 	{
 	case ShapeType::DebugBox:
-		m_debugShapes.push_back(
-			dynamic_cast<DebugShape*>(new DebugBox(position, m_world)));
-		++DynamicBodiesCount;
+		EmplaceShape(m_boxes, position, m_world);
 		break;
-
 	case ShapeType::DebugCircle:
-		m_debugShapes.push_back(
-			dynamic_cast<DebugShape*>(new DebugCircle(position, m_world))
-		);
-		++DynamicBodiesCount;
+		EmplaceShape(m_circles, position, m_world);
 		break;
 	case ShapeType::CustomPolygon:
-		m_debugShapes.push_back(
-			dynamic_cast<DebugShape*>(new CustomPolygon(position,
-				demo_data::customPolygonCoords, m_world)));
-		++DynamicBodiesCount;
+		EmplaceShape(m_polygons, position,
+			demo_data::customPolygonCoords, m_world);
 		break;
 	case ShapeType::MultiShape:
-		m_debugShapes.push_back(
-			dynamic_cast<MultiShape*>(new MultiShape(position, m_world)));
-		++DynamicBodiesCount;
+		EmplaceShape(m_multiShapes, position, m_world);
 		break;
 	default:
 		break;
@@ -64,15 +213,7 @@ void SpriteManager::HandleInput(const Event& event, RenderWindow& window)
 		if (event.key.code == Keyboard::W)
 		{
 			m_wireframeMode = !m_wireframeMode;
-
-			for (auto& shape : m_debugShapes)
-			{
-				if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-					polygon->SetWireframe(m_wireframeMode);
-
-				else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-					polygon->SetWireframe(m_wireframeMode);
-			}
+			ToggleWireframe();
 		}
 	}
 
@@ -83,7 +224,7 @@ void SpriteManager::HandleInput(const Event& event, RenderWindow& window)
 			EditorSettings::mode == RMBMode::TestPointMode)
 		{
 			m_rmbPressed = true;
-			DoTestPoint(window);
+			DoTestPoint(InputManager::GetInstance()->GetSnapshot().mouseWorld);
 		}
 	}
 
@@ -91,7 +232,7 @@ void SpriteManager::HandleInput(const Event& event, RenderWindow& window)
 	{
 		if (m_rmbPressed && EditorSettings::mode == RMBMode::TestPointMode)
 		{
-			DoTestPoint(window);
+			DoTestPoint(InputManager::GetInstance()->GetSnapshot().mouseWorld);
 		}
 	}
 
@@ -104,57 +245,102 @@ void SpriteManager::HandleInput(const Event& event, RenderWindow& window)
 		}
 	}
 
-	// TODO: Handle ray cast
-	// I.e., Update line and do ray cast if RMB is being held and
-	// editor is in RayCastMode
+	// Handle ray cast: the ray follows the mouse while RMB is held
+	if (event.type == Event::MouseButtonPressed &&
+		event.mouseButton.button == Mouse::Right &&
+		EditorSettings::mode == RMBMode::RayCastMode)
+	{
+		m_rayCasting = true;
+		m_rayStart = m_rayEnd = InputManager::GetInstance()->GetSnapshot().mouseWorld;
+	}
+
+	if (event.type == Event::MouseMoved && m_rayCasting)
+	{
+		m_rayEnd = InputManager::GetInstance()->GetSnapshot().mouseWorld;
+	}
+
+	if (event.type == Event::MouseButtonReleased &&
+		event.mouseButton.button == Mouse::Right)
+	{
+		m_rayCasting = false;
+	}
 }
 
-void SpriteManager::DoTestPoint(RenderWindow& window)
+/* Casts the editor ray against the stepped world, reporting every hit */
+void SpriteManager::DoRayCast()
 {
-	for (auto& shape : m_debugShapes)
+	m_rayQuery.Clear();
+
+	if (!m_rayCasting)
+		return;
+
+	m_rayQuery.AddRay(b2Vec2(m_rayStart.x/SCALE, m_rayStart.y/SCALE),
+		b2Vec2(m_rayEnd.x/SCALE, m_rayEnd.y/SCALE), RayQueryMode::All);
+	m_rayQuery.Execute(m_world);
+}
+
+const RayQueryBatch& SpriteManager::GetRayQuery() const
+{
+	return m_rayQuery;
+}
+
+/* Picks through a tiny AABB query around the point, so the cost follows
+   the shapes under the cursor rather than the shape count */
+void SpriteManager::DoTestPoint(const Vector2f& point)
+{
+	const b2Vec2 scaledPoint(point.x/SCALE, point.y/SCALE);
+	const b2Vec2 extent(b2_linearSlop, b2_linearSlop);
+
+	b2AABB aabb;
+	aabb.lowerBound = scaledPoint - extent;
+	aabb.upperBound = scaledPoint + extent;
+
+	m_pickedOwners.clear();
+	PickShapeCallback callback(m_pickedOwners, scaledPoint);
+	m_world->QueryAABB(&callback, aabb);
+
+	// Bodies with several fixtures are reported once per fixture
+	std::sort(m_pickedOwners.begin(), m_pickedOwners.end());
+	m_pickedOwners.erase(
+		std::unique(m_pickedOwners.begin(), m_pickedOwners.end()),
+		m_pickedOwners.end());
+
+	// Shapes no longer under the point
+	for (uintptr_t owner : m_highlightedOwners)
 	{
-		if (DebugBox* box = dynamic_cast<DebugBox*>(shape))
-		{
-			box->DoTestPoint(GetMousePosition(window));
-		}
-		else if (DebugCircle* circle = dynamic_cast<DebugCircle*>(shape))
-		{
-			circle->DoTestPoint(GetMousePosition(window));
-		}
-		else if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-		{
-			polygon->DoTestPoint(GetMousePosition(window));
-		}
-		else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-		{
-			polygon->DoTestPoint(GetMousePosition(window));
-		}
+		if (std::binary_search(m_pickedOwners.begin(), m_pickedOwners.end(), owner))
+			continue;
+
+		if (DebugShape* shape = GetShape(owner))
+			shape->SetHighlighted(false);
 	}
+
+	// The callback already ran the exact test, so no shape tests again
+	for (uintptr_t owner : m_pickedOwners)
+	{
+		if (DebugShape* shape = GetShape(owner))
+			shape->SetHighlighted(true);
+	}
+
+	m_highlightedOwners.swap(m_pickedOwners);
 }
 
 void SpriteManager::ResetTestPoint()
 {
 	m_rmbPressed = false;
 
-	for (auto& shape : m_debugShapes)
+	for (uintptr_t owner : m_highlightedOwners)
 	{
-		if (DebugBox* box = dynamic_cast<DebugBox*>(shape))
-		{
-			box->ResetTestPoint();
-		}
-		else if (DebugCircle* circle = dynamic_cast<DebugCircle*>(shape))
-		{
-			circle->ResetTestPoint();
-		}
-		else if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-		{
-			polygon->ResetTestPoint();
-		}
-		else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-		{
-			polygon->ResetTestPoint();
-		}
+		if (DebugShape* shape = GetShape(owner))
+			shape->SetHighlighted(false);
 	}
+
+	m_highlightedOwners.clear();
+}
+
+unsigned int SpriteManager::GetHighlightedShapeCount() const
+{
+	return static_cast<unsigned int>(m_highlightedOwners.size());
 }
 
 bool* SpriteManager::GetWireframeFlag()
@@ -164,17 +350,31 @@ bool* SpriteManager::GetWireframeFlag()
 
 void SpriteManager::ToggleWireframe()
 {
-	for (auto& shape : m_debugShapes)
-	{
-		if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-			polygon->SetWireframe(m_wireframeMode);
+	for (auto& polygon : m_polygons)
+		polygon.SetWireframe(m_wireframeMode);
 
-		if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-			polygon->SetWireframe(m_wireframeMode);
-	}
+	for (auto& polygon : m_multiShapes)
+		polygon.SetWireframe(m_wireframeMode);
+}
+
+/* Cache body transforms before each fixed physics step */
+void SpriteManager::SaveTransforms()
+{
+	for (auto& box : m_boxes)
+		box.SaveTransform();
+
+	for (auto& circle : m_circles)
+		circle.SaveTransform();
+
+	for (auto& polygon : m_polygons)
+		polygon.SaveTransform();
+
+	for (auto& polygon : m_multiShapes)
+		polygon.SaveTransform();
 }
 
-void SpriteManager::Update()
+/* Alpha blends rendered transforms between the previous and current step */
+void SpriteManager::Update(float alpha)
 {
 	/* Check destroy flag */
 	if (m_destroyFlag)
@@ -184,147 +384,263 @@ void SpriteManager::Update()
 		return;
 	}
 
-	/* Update debug shapes */
-	for (auto& shape : m_debugShapes)
+	/* Update debug shapes and mark those that left the level. Resting
+	   shapes keep their cached geometry and can't have left the level. */
+	m_activeShapeCount = 0;
+
+	for (auto& box : m_boxes)
 	{
-		if (DebugBox* box = dynamic_cast<DebugBox*>(shape))
-		{
-			box->Update();
-		}
-		else if (DebugCircle* circle = dynamic_cast<DebugCircle*>(shape))
-		{
-			circle->Update();
-		}
-		else if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-		{
-			polygon->Update();
-		}
-		else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-		{
-			polygon->Update();
-		}
+		if (!box.Update(alpha))
+			continue;
 
-		// Mark shapes for removal
-		float offset = 50.f;
-		Vector2f pos;
+		++m_activeShapeCount;
 
-		// Custom polygon requires b2Body to get its world position
-		if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-			pos = polygon->GetBodyPosition();
-		else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-			pos = polygon->GetBodyPosition();
+		if (IsOutsideLevel(box.GetPosition()))
+			box.MarkForDelete(true);
+	}
 
-		else
-			pos = shape->GetPosition();
+	for (auto& circle : m_circles)
+	{
+		if (!circle.Update(alpha))
+			continue;
 
-		sf::Vector2f levelSize;
-		levelSize.x = (float)EditorSettings::levelSize.x;
-		levelSize.y = (float)EditorSettings::levelSize.y;
+		++m_activeShapeCount;
 
-		if (pos.x < 0.f || pos.x > (levelSize.x + offset) ||
-			pos.y < 0.f || pos.y > (levelSize.y + offset))
-		{
-			shape->MarkForDelete(true);
-		}
+		if (IsOutsideLevel(circle.GetPosition()))
+			circle.MarkForDelete(true);
 	}
 
-	/* De-allocate shapes marked for remove */
-	m_debugShapes.erase(
-		std::remove_if(
-			m_debugShapes.begin(),
-			m_debugShapes.end(),
-			[](DebugShape* shape)
-			{
-				if (shape->IsMarkedForDelete())
-				{
-					--DynamicBodiesCount;
-
-					if (DebugBox* box = dynamic_cast<DebugBox*>(shape))
-					{
-						SafeDelete(box);
-						return true;
-					}
-					else if (DebugCircle* circle = dynamic_cast<DebugCircle*>(shape))
-					{
-						SafeDelete(circle);
-						return true;
-					}
-					else if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-					{
-						SafeDelete(polygon);
-						return true;
-					}
-					else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-					{
-						SafeDelete(polygon);
-						return true;
-					}
-					else {
-						SafeDelete(shape);
-						return true;
-					}
-				}
-
-				return false;
-			}),
-		m_debugShapes.end());
+	// Polygons require their b2Body to get a world position
+	for (auto& polygon : m_polygons)
+	{
+		if (!polygon.Update(alpha))
+			continue;
+
+		++m_activeShapeCount;
+
+		if (IsOutsideLevel(polygon.GetBodyPosition()))
+			polygon.MarkForDelete(true);
+	}
+
+	for (auto& polygon : m_multiShapes)
+	{
+		if (!polygon.Update(alpha))
+			continue;
+
+		++m_activeShapeCount;
+
+		if (IsOutsideLevel(polygon.GetBodyPosition()))
+			polygon.MarkForDelete(true);
+	}
+
+	/* Remove shapes marked for delete */
+	std::size_t removed = RemoveMarkedShapes(m_boxes) +
+		RemoveMarkedShapes(m_circles) +
+		RemoveMarkedShapes(m_polygons) +
+		RemoveMarkedShapes(m_multiShapes);
+
+	// Owners survive swap-and-pop, so surviving highlights stay valid and
+	// only the owners of removed shapes are dropped
+	if (removed > 0 && !m_highlightedOwners.empty())
+	{
+		m_highlightedOwners.erase(
+			std::remove_if(m_highlightedOwners.begin(), m_highlightedOwners.end(),
+				[this](uintptr_t owner) { return GetShape(owner) == nullptr; }),
+			m_highlightedOwners.end());
+	}
+
+	/* Ray cast once removed bodies are gone from the world */
+	if (EditorSettings::mode != RMBMode::RayCastMode)
+		m_rayCasting = false;
+
+	DoRayCast();
 }
 
-void SpriteManager::Draw(RenderWindow& window)
+/* Rebuilds the shape batch; split from Draw so it can run without a window */
+void SpriteManager::PrepareDraw()
+{
+	m_batch.Clear();
+
+	for (const auto& box : m_boxes)
+		box.AppendGeometry(m_batch);
+
+	for (const auto& circle : m_circles)
+		circle.AppendGeometry(m_batch);
+
+	for (const auto& polygon : m_polygons)
+		polygon.AppendGeometry(m_batch);
+
+	for (const auto& polygon : m_multiShapes)
+		polygon.AppendGeometry(m_batch);
+}
+
+/* Rebuilds the shape batch with only the shapes the broadphase reports
+   inside the visible area */
+void SpriteManager::PrepareDraw(const sf::FloatRect& visibleArea)
 {
-	for (auto& shape : m_debugShapes)
+	m_batch.Clear();
+	m_visibleOwners.clear();
+
+	VisibleShapeCallback callback(m_visibleOwners);
+	m_world->QueryAABB(&callback, ToAABB(visibleArea));
+
+	// Owners are replaced by their type and array index in place. Bodies
+	// with several fixtures are reported once per fixture, and sorting on
+	// type then index also keeps the unculled draw order.
+	const int indexBits = 24;
+	const uintptr_t indexMask = (uintptr_t(1) << indexBits) - 1;
+
+	for (auto& owner : m_visibleOwners)
 	{
-		if (DebugBox* box = dynamic_cast<DebugBox*>(shape))
-		{
-			box->Draw(window);
-		}
-		else if (DebugCircle* box = dynamic_cast<DebugCircle*>(shape))
-		{
-			box->Draw(window);
-		}
-		else if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
-		{
-			polygon->Draw(window);
-		}
-		else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
+		const OwnerSlot* slot = FindOwner(owner);
+		owner = slot ? static_cast<uintptr_t>(slot->type) << indexBits | slot->index : 0;
+	}
+
+	std::sort(m_visibleOwners.begin(), m_visibleOwners.end());
+	m_visibleOwners.erase(
+		std::unique(m_visibleOwners.begin(), m_visibleOwners.end()),
+		m_visibleOwners.end());
+
+	m_visibleShapeCount = 0;
+
+	for (uintptr_t key : m_visibleOwners)
+	{
+		if (key == 0)
+			continue;
+
+		auto type = static_cast<ShapeType>(key >> indexBits);
+		auto index = static_cast<std::uint32_t>(key & indexMask);
+
+		if (DebugShape* shape = GetShape(type, index))
 		{
-			polygon->Draw(window);
+			shape->AppendGeometry(m_batch);
+			++m_visibleShapeCount;
 		}
 	}
 }
 
-void SpriteManager::DestroyAllShapes()
+void SpriteManager::Draw(RenderWindow& window)
 {
-	for (auto& shape : m_debugShapes)
+	PrepareDraw(GetViewBounds(window.getView(), CULL_MARGIN));
+
+	/* Ray and its hits, nearest hit in red */
+	if (m_rayCasting)
 	{
-		--DynamicBodiesCount;
+		m_batch.AddLine(m_rayStart, m_rayEnd, sf::Color::Red);
 
-		if (DebugBox* box = dynamic_cast<DebugBox*>(shape))
-		{
-			SafeDelete(box);
-		}
-		else if (DebugCircle* circle = dynamic_cast<DebugCircle*>(shape))
-		{
-			SafeDelete(circle);
-		}
-		else if (CustomPolygon* polygon = dynamic_cast<CustomPolygon*>(shape))
+		const auto& hits = m_rayQuery.GetHits();
+		for (size_t i = 0; i < hits.size(); ++i)
 		{
-			SafeDelete(polygon);
-		}
-		else if (MultiShape* polygon = dynamic_cast<MultiShape*>(shape))
-		{
-			SafeDelete(polygon);
-		}
-		else
-		{
-			SafeDelete(shape);
+			Vector2f point(hits[i].point.x * SCALE, hits[i].point.y * SCALE);
+			sf::Color color = i == 0 ? sf::Color::Red : sf::Color(255, 165, 0);
+			m_batch.AddBox(point, 8.f, 0.f, color, 0.f, color);
 		}
 	}
 
-	m_debugShapes.clear();
+	m_batch.Draw(window);
+}
+
+const ShapeBatch& SpriteManager::GetBatch() const
+{
+	return m_batch;
+}
+
+unsigned int SpriteManager::GetActiveShapeCount() const
+{
+	return m_activeShapeCount;
+}
+
+unsigned int SpriteManager::GetVisibleShapeCount() const
+{
+	return m_visibleShapeCount;
+}
+
+DebugShape* SpriteManager::GetShape(ShapeType type, std::uint32_t index)
+{
+	switch (type)
+	{
+	case ShapeType::DebugBox:
+		if (index < m_boxes.size())
+			return &m_boxes[index];
+		break;
+	case ShapeType::DebugCircle:
+		if (index < m_circles.size())
+			return &m_circles[index];
+		break;
+	case ShapeType::CustomPolygon:
+		if (index < m_polygons.size())
+			return &m_polygons[index];
+		break;
+	case ShapeType::MultiShape:
+		if (index < m_multiShapes.size())
+			return &m_multiShapes[index];
+		break;
+	default:
+		break;
+	}
+
+	return nullptr;
+}
+
+/* Live owner slot of a packed owner, or nullptr if the shape is gone */
+const SpriteManager::OwnerSlot* SpriteManager::FindOwner(uintptr_t packedOwner) const
+{
+	b2BodyUserData data;
+	data.pointer = packedOwner;
+
+	BodyUserData owner;
+	if (!BodyUserData::Unpack(data, owner) || owner.slot >= m_owners.size())
+		return nullptr;
+
+	const OwnerSlot& slot = m_owners[owner.slot];
+	return slot.generation == owner.generation ? &slot : nullptr;
+}
+
+/* O(1) lookup through the packed owner in the body's user data */
+DebugShape* SpriteManager::GetShape(const b2Body* body)
+{
+	if (body == nullptr)
+		return nullptr;
+
+	DebugShape* shape = GetShape(body->GetUserData().pointer);
+
+	// Guard against user data from a body this manager doesn't own
+	if (shape != nullptr && shape->GetBody() != body)
+		return nullptr;
+
+	return shape;
+}
+
+/* Owner from a packed b2BodyUserData pointer, or nullptr */
+DebugShape* SpriteManager::GetShape(uintptr_t packedOwner)
+{
+	const OwnerSlot* slot = FindOwner(packedOwner);
+	return slot ? GetShape(slot->type, slot->index) : nullptr;
+}
+
+void SpriteManager::DestroyAllShapes()
+{
+	for (const auto& box : m_boxes)
+		ReleaseOwner(box);
+	for (const auto& circle : m_circles)
+		ReleaseOwner(circle);
+	for (const auto& polygon : m_polygons)
+		ReleaseOwner(polygon);
+	for (const auto& polygon : m_multiShapes)
+		ReleaseOwner(polygon);
+
+	DynamicBodiesCount -= static_cast<unsigned int>(m_boxes.size() +
+		m_circles.size() + m_polygons.size() + m_multiShapes.size());
+
+	m_boxes.clear();
+	m_circles.clear();
+	m_polygons.clear();
+	m_multiShapes.clear();
+
+	m_highlightedOwners.clear();
 }
 
 void SpriteManager::SetDestroryFlag(bool flag)
 {
 	m_destroyFlag = flag;
-}
\ No newline at end of file
+}
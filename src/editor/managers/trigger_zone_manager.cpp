@@ -0,0 +1,255 @@
+#include "editor/managers/trigger_zone_manager.hpp"
+#include <algorithm>
+#include <iterator>
+
+using std::size_t;
+using std::uint32_t;
+using std::uintptr_t;
+using std::vector;
+
+TriggerZoneManager::TriggerZoneManager(b2World* world)
+	: m_world(world)
+	, m_zoneCount(0)
+	, m_zonesChanged(false)
+	, m_queryOwner(0)
+{}
+
+ZoneHandle TriggerZoneManager::AddZone(const b2AABB& aabb, TriggerCallback callback)
+{
+	uint32_t index;
+
+	if (!m_freeZones.empty())
+	{
+		index = m_freeZones.back();
+		m_freeZones.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(m_zones.size());
+		m_zones.push_back(Zone{ aabb, -1, 0, TriggerCallback() });
+	}
+
+	Zone& slot = m_zones[index];
+	slot.aabb = aabb;
+	slot.proxy = m_tree.CreateProxy(aabb, reinterpret_cast<void*>(static_cast<uintptr_t>(index)));
+	slot.callback = std::move(callback);
+
+	++m_zoneCount;
+	m_zonesChanged = true;
+
+	ZoneHandle zone;
+	zone.index = index;
+	zone.generation = slot.generation;
+	return zone;
+}
+
+/* Frees a live slot and bumps its generation so outstanding handles go
+   stale */
+void TriggerZoneManager::ReleaseZone(uint32_t index)
+{
+	Zone& slot = m_zones[index];
+	m_tree.DestroyProxy(slot.proxy);
+	slot.proxy = -1;
+	slot.callback = TriggerCallback();
+	++slot.generation;
+
+	m_freeZones.push_back(index);
+	--m_zoneCount;
+	m_zonesChanged = true;
+}
+
+/* Overlaps with a removed zone are dropped without exit events, so the
+   slot can be reused straight away. Events not yet dispatched go too. */
+void TriggerZoneManager::RemoveZone(ZoneHandle zone)
+{
+	if (!IsValid(zone))
+		return;
+
+	ReleaseZone(zone.index);
+
+	auto drop = [zone](vector<TriggerPair>& pairs)
+	{
+		pairs.erase(std::remove_if(pairs.begin(), pairs.end(),
+			[zone](const TriggerPair& pair) { return pair.zone == zone; }),
+			pairs.end());
+	};
+
+	drop(m_previous);
+	drop(m_enter);
+	drop(m_stay);
+	drop(m_exit);
+}
+
+void TriggerZoneManager::MoveZone(ZoneHandle zone, const b2AABB& aabb)
+{
+	if (!IsValid(zone))
+		return;
+
+	Zone& slot = m_zones[zone.index];
+	if (slot.aabb.lowerBound == aabb.lowerBound && slot.aabb.upperBound == aabb.upperBound)
+		return;
+
+	// The tree only reinserts the proxy once it leaves its fat AABB
+	b2Vec2 displacement = aabb.GetCenter() - slot.aabb.GetCenter();
+	m_tree.MoveProxy(slot.proxy, aabb, displacement);
+
+	slot.aabb = aabb;
+	m_zonesChanged = true;
+}
+
+void TriggerZoneManager::SetCallback(ZoneHandle zone, TriggerCallback callback)
+{
+	if (IsValid(zone))
+		m_zones[zone.index].callback = std::move(callback);
+}
+
+/* Slots are kept so their generations survive and old handles stay stale */
+void TriggerZoneManager::Clear()
+{
+	for (uint32_t index = 0; index < m_zones.size(); ++index)
+	{
+		if (m_zones[index].proxy != -1)
+			ReleaseZone(index);
+	}
+
+	m_previous.clear();
+	m_current.clear();
+	m_enter.clear();
+	m_stay.clear();
+	m_exit.clear();
+}
+
+bool TriggerZoneManager::IsValid(ZoneHandle zone) const
+{
+	return zone.index < m_zones.size() && m_zones[zone.index].proxy != -1 &&
+		m_zones[zone.index].generation == zone.generation;
+}
+
+const b2AABB& TriggerZoneManager::GetZoneAABB(ZoneHandle zone) const
+{
+	return m_zones[zone.index].aabb;
+}
+
+size_t TriggerZoneManager::GetZoneCount() const
+{
+	return m_zoneCount;
+}
+
+/* Tree proxies are fattened, so confirm against the exact zone bounds */
+bool TriggerZoneManager::QueryCallback(std::int32_t proxyId)
+{
+	auto index = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(m_tree.GetUserData(proxyId)));
+
+	if (b2TestOverlap(m_zones[index].aabb, m_queryAABB))
+	{
+		ZoneHandle zone;
+		zone.index = index;
+		zone.generation = m_zones[index].generation;
+		m_current.push_back(TriggerPair{ m_queryOwner, zone });
+	}
+
+	return true;
+}
+
+void TriggerZoneManager::QueryBody(b2Body* body, uintptr_t owner)
+{
+	m_queryOwner = owner;
+
+	for (b2Fixture* fixture = body->GetFixtureList(); fixture; fixture = fixture->GetNext())
+	{
+		int32 childCount = fixture->GetShape()->GetChildCount();
+
+		for (int32 child = 0; child < childCount; ++child)
+		{
+			m_queryAABB = fixture->GetAABB(child);
+			m_tree.Query(this, m_queryAABB);
+		}
+	}
+}
+
+void TriggerZoneManager::KeepPreviousOverlaps(uintptr_t owner)
+{
+	auto range = std::equal_range(m_previous.begin(), m_previous.end(),
+		TriggerPair{ owner, ZoneHandle() },
+		[](const TriggerPair& a, const TriggerPair& b) { return a.owner < b.owner; });
+
+	m_current.insert(m_current.end(), range.first, range.second);
+}
+
+void TriggerZoneManager::Update()
+{
+	m_current.clear();
+	m_enter.clear();
+	m_stay.clear();
+	m_exit.clear();
+
+	if (m_zoneCount > 0)
+	{
+		for (b2Body* body = m_world->GetBodyList(); body; body = body->GetNext())
+		{
+			if (body->GetType() != b2_dynamicBody || !body->IsEnabled())
+				continue;
+
+			// Bodies without an owner cannot be reported
+			uintptr_t owner = body->GetUserData().pointer;
+			if (owner == 0)
+				continue;
+
+			if (!body->IsAwake() && !m_zonesChanged)
+				KeepPreviousOverlaps(owner);
+			else
+				QueryBody(body, owner);
+		}
+	}
+
+	// Bodies with several fixtures report the same zone more than once
+	std::sort(m_current.begin(), m_current.end());
+	m_current.erase(std::unique(m_current.begin(), m_current.end()), m_current.end());
+
+	std::set_difference(m_current.begin(), m_current.end(),
+		m_previous.begin(), m_previous.end(), std::back_inserter(m_enter));
+	std::set_intersection(m_current.begin(), m_current.end(),
+		m_previous.begin(), m_previous.end(), std::back_inserter(m_stay));
+	std::set_difference(m_previous.begin(), m_previous.end(),
+		m_current.begin(), m_current.end(), std::back_inserter(m_exit));
+
+	m_previous.swap(m_current);
+	m_zonesChanged = false;
+}
+
+/* Exits first so a body moving between zones leaves before it enters.
+   Zones must not be added or removed from inside a callback. */
+void TriggerZoneManager::DispatchCallbacks()
+{
+	auto dispatch = [this](const vector<TriggerPair>& pairs, TriggerEventType type)
+	{
+		for (const TriggerPair& pair : pairs)
+		{
+			if (!IsValid(pair.zone))
+				continue;
+
+			const Zone& zone = m_zones[pair.zone.index];
+			if (zone.callback)
+				zone.callback(type, pair.zone, pair.owner);
+		}
+	};
+
+	dispatch(m_exit, TriggerEventType::Exit);
+	dispatch(m_enter, TriggerEventType::Enter);
+	dispatch(m_stay, TriggerEventType::Stay);
+}
+
+const vector<TriggerPair>& TriggerZoneManager::GetEnterEvents() const
+{
+	return m_enter;
+}
+
+const vector<TriggerPair>& TriggerZoneManager::GetStayEvents() const
+{
+	return m_stay;
+}
+
+const vector<TriggerPair>& TriggerZoneManager::GetExitEvents() const
+{
+	return m_exit;
+}
\ No newline at end of file
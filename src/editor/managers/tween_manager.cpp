@@ -0,0 +1,209 @@
+#include "editor/managers/tween_manager.hpp"
+#include "editor/animation/easing.hpp"
+#include <algorithm>
+
+using std::shared_ptr;
+using std::uint32_t;
+
+shared_ptr<TweenManager> TweenManager::m_instance;
+
+TweenManager::TweenManager()
+	: m_property(MAX_TWEENS, nullptr)
+	, m_startValue(MAX_TWEENS, 0.f)
+	, m_targetValue(MAX_TWEENS, 0.f)
+	, m_changeValue(MAX_TWEENS, 0.f)
+	, m_duration(MAX_TWEENS, 0.f)
+	, m_elapsedTime(MAX_TWEENS, 0.f)
+	, m_function(MAX_TWEENS, InterpFunc::Linear)
+	, m_slots(MAX_TWEENS, SlotInfo{ 0, 0 })
+	, m_groupStart(FUNCTION_COUNT + 1, 0)
+	, m_batchSlots(MAX_TWEENS, 0)
+	, m_batchT(MAX_TWEENS, 0.f)
+	, m_batchB(MAX_TWEENS, 0.f)
+	, m_batchC(MAX_TWEENS, 0.f)
+	, m_batchD(MAX_TWEENS, 0.f)
+	, m_batchOut(MAX_TWEENS, 0.f)
+{
+	m_freeSlots.reserve(MAX_TWEENS);
+	m_active.reserve(MAX_TWEENS);
+
+	// Hand out low slots first
+	for (uint32_t i = MAX_TWEENS; i > 0; --i)
+		m_freeSlots.push_back(i - 1);
+}
+
+shared_ptr<TweenManager> TweenManager::GetInstance()
+{
+	if (m_instance.get() == nullptr)
+		m_instance.reset(new TweenManager);
+
+	return m_instance;
+}
+
+TweenHandle TweenManager::Spawn(float* property, float startValue,
+	float targetValue, float duration, InterpFunc function)
+{
+	if (m_freeSlots.empty())
+	{
+		*property = targetValue;
+		return TweenHandle();
+	}
+
+	uint32_t index = m_freeSlots.back();
+	m_freeSlots.pop_back();
+
+	m_property[index] = property;
+	m_startValue[index] = startValue;
+	m_targetValue[index] = targetValue;
+	m_changeValue[index] = targetValue - startValue;
+	m_duration[index] = duration;
+	m_elapsedTime[index] = 0.f;
+	m_function[index] = function;
+
+	// Unknown values fall back to QuartEaseOut, like GetEaseFunc
+	int f = static_cast<int>(function);
+	if (f < 0 || f >= FUNCTION_COUNT)
+		m_function[index] = InterpFunc::QuartEaseOut;
+
+	m_slots[index].activeIndex = static_cast<uint32_t>(m_active.size());
+	m_active.push_back(index);
+
+	TweenHandle handle;
+	handle.index = index;
+	handle.generation = m_slots[index].generation;
+	return handle;
+}
+
+bool TweenManager::IsCurrent(const TweenHandle& handle) const
+{
+	return handle.IsValid() && handle.index < MAX_TWEENS &&
+		m_slots[handle.index].generation == handle.generation;
+}
+
+/* Swap-removes a slot from the active list and bumps its generation so
+   outstanding handles go stale */
+void TweenManager::Release(uint32_t index)
+{
+	uint32_t activeIndex = m_slots[index].activeIndex;
+	uint32_t last = m_active.back();
+
+	m_active[activeIndex] = last;
+	m_slots[last].activeIndex = activeIndex;
+	m_active.pop_back();
+
+	m_property[index] = nullptr;
+	++m_slots[index].generation;
+	m_freeSlots.push_back(index);
+}
+
+void TweenManager::Stop(TweenHandle& handle)
+{
+	if (IsCurrent(handle))
+		Release(handle.index);
+
+	handle = TweenHandle();
+}
+
+void TweenManager::StopAll()
+{
+	while (!m_active.empty())
+		Release(m_active.back());
+}
+
+bool TweenManager::IsAnimating(const TweenHandle& handle) const
+{
+	return IsCurrent(handle);
+}
+
+void TweenManager::Update(float dt)
+{
+	// Advance time and finish tweens that have run their duration.
+	// Iterate backwards so finished tweens can be swap-removed in place.
+	for (std::size_t i = m_active.size(); i > 0; --i)
+	{
+		uint32_t index = m_active[i - 1];
+		m_elapsedTime[index] += dt;
+
+		if (m_elapsedTime[index] >= m_duration[index])
+		{
+			*m_property[index] = m_targetValue[index];
+			Release(index);
+		}
+	}
+
+	if (m_active.empty())
+		return;
+
+	// Counting sort of the running tweens by easing function
+	std::fill(m_groupStart.begin(), m_groupStart.end(), 0);
+	for (uint32_t index : m_active)
+		++m_groupStart[static_cast<int>(m_function[index]) + 1];
+
+	for (int f = 0; f < FUNCTION_COUNT; ++f)
+		m_groupStart[f + 1] += m_groupStart[f];
+
+	for (uint32_t index : m_active)
+	{
+		uint32_t slot = m_groupStart[static_cast<int>(m_function[index])]++;
+
+		m_batchSlots[slot] = index;
+		m_batchT[slot] = m_elapsedTime[index];
+		m_batchB[slot] = m_startValue[index];
+		m_batchC[slot] = m_changeValue[index];
+		m_batchD[slot] = m_duration[index];
+	}
+
+	// Placing shifted each group start to the next group's, so walk the
+	// groups from the front using the end offsets
+	uint32_t begin = 0;
+	for (int f = 0; f < FUNCTION_COUNT; ++f)
+	{
+		uint32_t end = m_groupStart[f];
+		if (end > begin && !m_tables.empty())
+		{
+			m_tables[f].EvaluateBatch(&m_batchT[begin], &m_batchB[begin],
+				&m_batchC[begin], &m_batchD[begin], &m_batchOut[begin], end - begin);
+		}
+		else if (end > begin)
+		{
+			EaseBatch(static_cast<InterpFunc>(f), &m_batchT[begin], &m_batchB[begin],
+				&m_batchC[begin], &m_batchD[begin], &m_batchOut[begin], end - begin);
+		}
+		begin = end;
+	}
+
+	std::size_t count = m_active.size();
+	for (std::size_t i = 0; i < count; ++i)
+		*m_property[m_batchSlots[i]] = m_batchOut[i];
+}
+
+void TweenManager::UseLookupTables(std::size_t resolution)
+{
+	m_tables.clear();
+
+	if (resolution == 0)
+		return;
+
+	m_tables.reserve(FUNCTION_COUNT);
+	for (int f = 0; f < FUNCTION_COUNT; ++f)
+		m_tables.emplace_back(static_cast<InterpFunc>(f), resolution);
+}
+
+bool TweenManager::UsingLookupTables() const
+{
+	return !m_tables.empty();
+}
+
+std::size_t TweenManager::GetLookupTableMemory() const
+{
+	std::size_t bytes = 0;
+	for (const auto& table : m_tables)
+		bytes += table.GetMemoryUsage();
+
+	return bytes;
+}
+
+std::size_t TweenManager::GetActiveCount() const
+{
+	return m_active.size();
+}
\ No newline at end of file
@@ -3,26 +3,24 @@
 using sf::Mouse;
 using sf::RenderWindow;
 using sf::Vector2f;
-using sf::Vector2i;
 using sf::Text;
 using std::string;
 
 /** Get mouse coordinates relative to SFML window.
+ *
+ *  The pixel is taken relative to the window before mapping, so the
+ *  result stays correct when the view is zoomed.
  */
 sf::Vector2f GetMousePosition(const RenderWindow& window)
 {
-	Vector2f mousePosition = window.mapPixelToCoords(Mouse::getPosition(), window.getView());
-	Vector2i windowOffset = window.getPosition();
-
-	return Vector2f(mousePosition.x - (float)windowOffset.x,
-					mousePosition.y - (float)windowOffset.y);
+	return window.mapPixelToCoords(Mouse::getPosition(window), window.getView());
 }
 
 /** Renders a label next to the mouse cursor in the SFML window.
  */
-void SetMouseLabel(Text& label, RenderWindow& window)
+void SetMouseLabel(Text& label, const Vector2f& mousePos)
 {
-	Vector2f pos = (GetMousePosition(window) + sf::Vector2f(10.f, -15.f));
+	Vector2f pos = (mousePos + sf::Vector2f(10.f, -15.f));
 	string xPos = std::to_string(pos.x);
 	string yPos = std::to_string(pos.y);
 
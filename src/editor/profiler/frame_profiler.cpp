@@ -0,0 +1,242 @@
+#include "editor/profiler/frame_profiler.hpp"
+#include <algorithm>
+
+using std::shared_ptr;
+using std::size_t;
+
+shared_ptr<FrameProfiler> FrameProfiler::m_instance;
+
+namespace
+{
+	float ToMilliseconds(FrameProfiler::Clock::duration duration)
+	{
+		return std::chrono::duration<float, std::milli>(duration).count();
+	}
+}
+
+FrameProfiler::FrameProfiler()
+	: m_history()
+	, m_head(0)
+	, m_count(0)
+	, m_current()
+	, m_frameNumber(0)
+	, m_paused(false)
+{
+	m_frameStart = Clock::now();
+}
+
+shared_ptr<FrameProfiler> FrameProfiler::GetInstance()
+{
+	if (m_instance.get() == nullptr)
+		m_instance.reset(new FrameProfiler);
+
+	return m_instance;
+}
+
+const char* FrameProfiler::GetScopeName(ProfileScope scope)
+{
+	switch (scope)
+	{
+		case ProfileScope::PollEvents:		return "Poll Events";
+		case ProfileScope::ImGuiUpdate:		return "ImGui Update";
+		case ProfileScope::CameraUpdate:	return "Camera Update";
+		case ProfileScope::WorldStep:		return "World Step";
+		case ProfileScope::EdgeChainUpdate:	return "Edge Chain Update";
+		case ProfileScope::SpriteUpdate:	return "Sprite Update";
+		case ProfileScope::DrawGrid:		return "Draw Grid";
+		case ProfileScope::DrawTriggers:	return "Draw Triggers";
+		case ProfileScope::DrawSprites:		return "Draw Sprites";
+		case ProfileScope::DrawEdgeChains:	return "Draw Edge Chains";
+		case ProfileScope::DrawImGui:		return "Draw ImGui";
+		case ProfileScope::Display:			return "Display";
+		default:							return "";
+	}
+}
+
+void FrameProfiler::BeginFrame()
+{
+	m_current = FrameSample();
+	m_frameStart = Clock::now();
+}
+
+/* Commit the current frame to the history ring buffer */
+void FrameProfiler::EndFrame()
+{
+	m_current.frameTime = ToMilliseconds(Clock::now() - m_frameStart);
+	++m_frameNumber;
+
+	m_trace.Update();
+
+	if (m_paused)
+		return;
+
+	m_history[m_head] = m_current;
+	m_head = (m_head + 1) % HISTORY_SIZE;
+	m_count = std::min(m_count + 1, HISTORY_SIZE);
+}
+
+void FrameProfiler::AddScopeTime(ProfileScope scope, float milliseconds)
+{
+	m_current.scopes[static_cast<size_t>(scope)] += milliseconds;
+}
+
+void FrameProfiler::AddScope(ProfileScope scope, Clock::time_point start,
+	Clock::time_point end)
+{
+	AddScopeTime(scope, ToMilliseconds(end - start));
+	m_trace.RecordScope(scope, start, end, m_frameNumber);
+}
+
+/* Called after every b2World::Step, as a frame can take several steps */
+void FrameProfiler::AddWorldProfile(const b2Profile& profile)
+{
+	WorldProfile& world = m_current.world;
+
+	world.step			+= profile.step;
+	world.collide		+= profile.collide;
+	world.solve			+= profile.solve;
+	world.solveInit		+= profile.solveInit;
+	world.solveVelocity += profile.solveVelocity;
+	world.solvePosition += profile.solvePosition;
+	world.solveTOI		+= profile.solveTOI;
+	world.broadphase	+= profile.broadphase;
+	++world.stepCount;
+}
+
+/* Contact listener output, read after each b2World::Step */
+void FrameProfiler::AddContactEvents(int eventCount, int impactCount, int cueCount)
+{
+	m_current.world.contactEvents += eventCount;
+	m_current.world.impacts += impactCount;
+	m_current.world.impactCues += cueCount;
+}
+
+/* World counters for the trace, recorded once per frame */
+void FrameProfiler::AddCounters(int bodyCount, int contactCount, int proxyCount)
+{
+	m_trace.RecordCounters(m_frameNumber, bodyCount, contactCount, proxyCount);
+}
+
+bool FrameProfiler::StartTrace(float seconds)
+{
+	return m_trace.Start(seconds, TraceRecorder::MakeDefaultPath());
+}
+
+TraceRecorder& FrameProfiler::GetTraceRecorder()
+{
+	return m_trace;
+}
+
+std::uint64_t FrameProfiler::GetFrameNumber() const
+{
+	return m_frameNumber;
+}
+
+void FrameProfiler::SetPaused(bool paused)
+{
+	m_paused = paused;
+}
+
+bool* FrameProfiler::GetPausedFlag()
+{
+	return &m_paused;
+}
+
+size_t FrameProfiler::GetSampleCount() const
+{
+	return m_count;
+}
+
+const FrameSample& FrameProfiler::GetSample(size_t age) const
+{
+	size_t index = (m_head + HISTORY_SIZE - 1 - age) % HISTORY_SIZE;
+	return m_history[index];
+}
+
+void FrameProfiler::GetFrameTimePercentiles(float& p50, float& p95, float& p99) const
+{
+	p50 = p95 = p99 = 0.f;
+
+	if (m_count == 0)
+		return;
+
+	std::array<float, HISTORY_SIZE> times;
+	for (size_t i = 0; i < m_count; ++i)
+		times[i] = GetSample(i).frameTime;
+
+	std::sort(times.begin(), times.begin() + m_count);
+
+	// Nearest-rank percentiles
+	auto percentile = [&](float p)
+	{
+		size_t rank = static_cast<size_t>(p * m_count + .999f);
+		rank = std::min(std::max<size_t>(rank, 1), m_count);
+		return times[rank - 1];
+	};
+
+	p50 = percentile(.50f);
+	p95 = percentile(.95f);
+	p99 = percentile(.99f);
+}
+
+FrameSample FrameProfiler::GetAverageSample() const
+{
+	FrameSample average = FrameSample();
+
+	if (m_count == 0)
+		return average;
+
+	for (size_t i = 0; i < m_count; ++i)
+	{
+		const FrameSample& sample = GetSample(i);
+
+		for (size_t s = 0; s < SCOPE_COUNT; ++s)
+			average.scopes[s] += sample.scopes[s];
+
+		average.frameTime			 += sample.frameTime;
+		average.world.step			 += sample.world.step;
+		average.world.collide		 += sample.world.collide;
+		average.world.solve			 += sample.world.solve;
+		average.world.solveInit		 += sample.world.solveInit;
+		average.world.solveVelocity  += sample.world.solveVelocity;
+		average.world.solvePosition  += sample.world.solvePosition;
+		average.world.solveTOI		 += sample.world.solveTOI;
+		average.world.broadphase	 += sample.world.broadphase;
+		average.world.stepCount		 += sample.world.stepCount;
+		average.world.contactEvents	 += sample.world.contactEvents;
+		average.world.impacts		 += sample.world.impacts;
+		average.world.impactCues	 += sample.world.impactCues;
+	}
+
+	float n = static_cast<float>(m_count);
+
+	for (size_t s = 0; s < SCOPE_COUNT; ++s)
+		average.scopes[s] /= n;
+
+	average.frameTime			/= n;
+	average.world.step			/= n;
+	average.world.collide		/= n;
+	average.world.solve			/= n;
+	average.world.solveInit		/= n;
+	average.world.solveVelocity /= n;
+	average.world.solvePosition /= n;
+	average.world.solveTOI		/= n;
+	average.world.broadphase	/= n;
+
+	return average;
+}
+
+// --------------------------------------------------------------------------------
+// ScopedTimer
+// --------------------------------------------------------------------------------
+
+ScopedTimer::ScopedTimer(ProfileScope scope)
+	: m_scope(scope)
+	, m_start(FrameProfiler::Clock::now())
+{}
+
+ScopedTimer::~ScopedTimer()
+{
+	FrameProfiler::GetInstance()->AddScope(m_scope, m_start,
+		FrameProfiler::Clock::now());
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "editor/profiler/trace_recorder.hpp"
+#include "editor/profiler/frame_profiler.hpp"
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <functional>
+
+using std::string;
+using std::uint32_t;
+using std::uint64_t;
+using std::int64_t;
+
+namespace
+{
+	/* Small stable per-thread id for the trace viewer's thread lanes */
+	uint32_t GetCurrentThreadId()
+	{
+		static thread_local uint32_t id = static_cast<uint32_t>(
+			std::hash<std::thread::id>()(std::this_thread::get_id()));
+		return id;
+	}
+
+	void WriteEvent(std::ofstream& file, const TraceEvent& event, bool& first)
+	{
+		file << (first ? "\n" : ",\n");
+		first = false;
+
+		if (event.type == TraceEvent::Type::Scope)
+		{
+			file << "{\"name\":\"" << FrameProfiler::GetScopeName(event.scope)
+				 << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1"
+				 << ",\"tid\":" << event.threadId
+				 << ",\"ts\":" << event.start
+				 << ",\"dur\":" << event.duration
+				 << ",\"args\":{\"frame\":" << event.frame << "}}";
+		}
+		else
+		{
+			file << "{\"name\":\"World\",\"cat\":\"counters\",\"ph\":\"C\",\"pid\":1"
+				 << ",\"tid\":" << event.threadId
+				 << ",\"ts\":" << event.start
+				 << ",\"args\":{\"bodies\":" << event.bodyCount
+				 << ",\"contacts\":" << event.contactCount
+				 << ",\"proxies\":" << event.proxyCount << "}}";
+		}
+	}
+}
+
+TraceRecorder::TraceRecorder()
+	: m_buffer(BUFFER_CAPACITY)
+	, m_recording(false)
+	, m_writing(false)
+	, m_dropped(0)
+	, m_duration(0.f)
+{}
+
+TraceRecorder::~TraceRecorder()
+{
+	m_recording.store(false, std::memory_order_release);
+	JoinWriter();
+}
+
+/* Begin a recording of the given length; ignored while one is in progress */
+bool TraceRecorder::Start(float seconds, const string& path)
+{
+	if (m_recording.load() || m_writing.load())
+		return false;
+
+	JoinWriter();
+
+	m_buffer.Clear();
+	m_dropped.store(0);
+	m_duration = seconds;
+	m_path = path;
+	m_startTime = Clock::now();
+
+	m_writing.store(true);
+	m_recording.store(true, std::memory_order_release);
+	m_writer = std::thread(&TraceRecorder::WriterLoop, this);
+
+	return true;
+}
+
+/* Called once per frame to end the recording after its duration */
+void TraceRecorder::Update()
+{
+	if (m_recording.load(std::memory_order_relaxed) &&
+		GetProgress() >= 1.f)
+	{
+		m_recording.store(false, std::memory_order_release);
+	}
+
+	// Reap the writer once it has flushed the file
+	if (!m_writing.load(std::memory_order_acquire))
+		JoinWriter();
+}
+
+void TraceRecorder::RecordScope(ProfileScope scope, Clock::time_point start,
+	Clock::time_point end, uint64_t frame)
+{
+	if (!m_recording.load(std::memory_order_relaxed))
+		return;
+
+	TraceEvent event;
+	event.type = TraceEvent::Type::Scope;
+	event.scope = scope;
+	event.threadId = GetCurrentThreadId();
+	event.frame = frame;
+	event.start = ToMicroseconds(start);
+	event.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+		end - start).count();
+	event.bodyCount = event.contactCount = event.proxyCount = 0;
+
+	if (!m_buffer.Push(event))
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TraceRecorder::RecordCounters(uint64_t frame, int bodyCount,
+	int contactCount, int proxyCount)
+{
+	if (!m_recording.load(std::memory_order_relaxed))
+		return;
+
+	TraceEvent event;
+	event.type = TraceEvent::Type::Counters;
+	event.scope = ProfileScope::Count;
+	event.threadId = GetCurrentThreadId();
+	event.frame = frame;
+	event.start = ToMicroseconds(Clock::now());
+	event.duration = 0;
+	event.bodyCount = bodyCount;
+	event.contactCount = contactCount;
+	event.proxyCount = proxyCount;
+
+	if (!m_buffer.Push(event))
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+/* Background thread: drains the buffer into the JSON file */
+void TraceRecorder::WriterLoop()
+{
+	std::ofstream file(m_path);
+	bool first = true;
+
+	if (file)
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	TraceEvent event;
+
+	while (true)
+	{
+		bool recording = m_recording.load(std::memory_order_acquire);
+		bool drained = true;
+
+		while (m_buffer.Pop(event))
+		{
+			drained = false;
+			if (file)
+				WriteEvent(file, event, first);
+		}
+
+		// The render thread stops pushing before it clears m_recording,
+		// so an empty buffer seen after that is final
+		if (!recording && drained)
+			break;
+
+		if (drained)
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+
+	if (file)
+	{
+		file << "\n],\"otherData\":{\"droppedEvents\":"
+			 << m_dropped.load() << "}}\n";
+	}
+
+	m_writing.store(false, std::memory_order_release);
+}
+
+void TraceRecorder::JoinWriter()
+{
+	if (m_writer.joinable())
+		m_writer.join();
+}
+
+int64_t TraceRecorder::ToMicroseconds(Clock::time_point time) const
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		time - m_startTime).count();
+}
+
+bool TraceRecorder::IsRecording() const
+{
+	return m_recording.load(std::memory_order_relaxed);
+}
+
+bool TraceRecorder::IsWriting() const
+{
+	return m_writing.load(std::memory_order_relaxed);
+}
+
+float TraceRecorder::GetProgress() const
+{
+	if (m_duration <= 0.f)
+		return 1.f;
+
+	float elapsed = std::chrono::duration<float>(Clock::now() - m_startTime).count();
+	return std::min(elapsed / m_duration, 1.f);
+}
+
+uint64_t TraceRecorder::GetDroppedCount() const
+{
+	return m_dropped.load(std::memory_order_relaxed);
+}
+
+const string& TraceRecorder::GetPath() const
+{
+	return m_path;
+}
+
+/* trace_YYYYMMDD_HHMMSS.json in the working directory */
+string TraceRecorder::MakeDefaultPath()
+{
+	std::time_t now = std::time(nullptr);
+	char buffer[32];
+	std::strftime(buffer, sizeof(buffer), "trace_%Y%m%d_%H%M%S.json",
+		std::localtime(&now));
+	return buffer;
+}
\ No newline at end of file
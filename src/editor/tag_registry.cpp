@@ -0,0 +1,57 @@
+#include "editor/tag_registry.hpp"
+
+using std::shared_ptr;
+using std::string;
+
+shared_ptr<TagRegistry> TagRegistry::m_instance;
+
+TagRegistry::TagRegistry()
+{
+	// Storage never reallocates, so references from GetTag stay valid
+	m_tags.reserve(MAX_TAGS);
+
+	m_tags.push_back("");
+	m_ids[""] = NO_TAG;
+}
+
+shared_ptr<TagRegistry> TagRegistry::GetInstance()
+{
+	if (m_instance.get() == nullptr)
+		m_instance.reset(new TagRegistry);
+
+	return m_instance;
+}
+
+TagId TagRegistry::Register(const string& tag)
+{
+	// Only the first use of a tag allocates
+	auto pos = m_ids.find(tag);
+
+	if (pos != m_ids.end())
+		return pos->second;
+
+	if (m_tags.size() >= MAX_TAGS)
+		return NO_TAG;
+
+	TagId id = static_cast<TagId>(m_tags.size());
+	m_tags.push_back(tag);
+	m_ids[tag] = id;
+
+	return id;
+}
+
+TagId TagRegistry::Find(const string& tag) const
+{
+	auto pos = m_ids.find(tag);
+	return pos != m_ids.end() ? pos->second : NO_TAG;
+}
+
+const string& TagRegistry::GetTag(TagId id) const
+{
+	return id < m_tags.size() ? m_tags[id] : m_tags[NO_TAG];
+}
+
+std::size_t TagRegistry::GetTagCount() const
+{
+	return m_tags.size();
+}
\ No newline at end of file
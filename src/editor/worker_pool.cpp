@@ -0,0 +1,110 @@
+#include "editor/worker_pool.hpp"
+#include <algorithm>
+
+using std::size_t;
+
+WorkerPool::WorkerPool(size_t threadCount)
+	: m_task(nullptr)
+	, m_count(0)
+	, m_grain(1)
+	, m_next(0)
+	, m_busy(0)
+	, m_generation(0)
+	, m_quit(false)
+{
+	m_threads.reserve(threadCount);
+
+	for (size_t i = 0; i < threadCount; ++i)
+		m_threads.emplace_back(&WorkerPool::WorkerLoop, this, i + 1);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+
+	m_wake.notify_all();
+
+	for (auto& thread : m_threads)
+		thread.join();
+}
+
+size_t WorkerPool::GetDefaultThreadCount()
+{
+	unsigned int hardwareThreads = std::thread::hardware_concurrency();
+	return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+size_t WorkerPool::GetWorkerCount() const
+{
+	return m_threads.size() + 1;
+}
+
+void WorkerPool::RunChunks(size_t worker)
+{
+	for (;;)
+	{
+		size_t begin = m_next.fetch_add(m_grain, std::memory_order_relaxed);
+		if (begin >= m_count)
+			break;
+
+		(*m_task)(begin, std::min(begin + m_grain, m_count), worker);
+	}
+}
+
+void WorkerPool::WorkerLoop(size_t worker)
+{
+	std::uint64_t seen = 0;
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&]() { return m_quit || m_generation != seen; });
+
+			if (m_quit)
+				return;
+
+			seen = m_generation;
+		}
+
+		RunChunks(worker);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_busy == 0)
+			m_done.notify_one();
+	}
+}
+
+void WorkerPool::ParallelFor(size_t count, size_t grain, const Task& task)
+{
+	grain = std::max<size_t>(grain, 1);
+
+	// Not worth waking anyone for a single chunk
+	if (m_threads.empty() || count <= grain)
+	{
+		for (size_t begin = 0; begin < count; begin += grain)
+			task(begin, std::min(begin + grain, count), 0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &task;
+		m_count = count;
+		m_grain = grain;
+		m_next.store(0, std::memory_order_relaxed);
+		m_busy = m_threads.size();
+		++m_generation;
+	}
+
+	m_wake.notify_all();
+	RunChunks(0);
+
+	// Workers may still be finishing their last chunk
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_busy == 0; });
+	m_task = nullptr;
+}
\ No newline at end of file
@@ -221,13 +221,15 @@ void RenderEditorControls()
 		std::make_pair("Space", "Cycle RMB modes"),
 		std::make_pair("E", 	"Toggle edge chain active state"),
 		std::make_pair("W", 	"Toggle wireframe rendering mode"),
+		std::make_pair("T", 	"Record a Chrome trace of frame timings"),
 		std::make_pair("Esc", 	"Close window"),
 		std::make_pair("\nMMB", "\nSpawn circle rigid body"),
 		std::make_pair("RMB", 	"Perform selected RMB mode"),
+		std::make_pair("Wheel", "Zoom camera about the cursor"),
 	};
 	{
 		ImGui::PushStyleVar(ImGuiStyleVar_ChildRounding, 3.0f);
-		ImGui::BeginChild("ControlsChild", ImVec2(0, 145.f), true, ImGuiWindowFlags_None);
+		ImGui::BeginChild("ControlsChild", ImVec2(0, 179.f), true, ImGuiWindowFlags_None);
 
 		for (auto& control : controls)
 		{
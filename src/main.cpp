@@ -7,25 +7,28 @@
 
 /* Callbacks */
 #include "editor/callbacks/my_contact_listener.hpp"
+#include "editor/callbacks/impact_aggregator.hpp"
 #include "editor/callbacks/trigger_zone.hpp"
 
+/* Profiling */
+#include "editor/profiler/frame_profiler.hpp"
+
 /* Managers */
 #include "editor/managers/camera_manager.hpp"
 #include "editor/managers/imgui_manager.hpp"
 #include "editor/managers/drag_cache_manager.hpp"
+#include "editor/managers/tween_manager.hpp"
+#include "editor/managers/trigger_zone_manager.hpp"
+#include "editor/managers/input_manager.hpp"
 
 #include <string>
 #include <algorithm>
 #include <ctime>
 #include <cstdlib>
+#include <cmath>
 
 using namespace physics;
 
-// Set initial editor mode
-RMBMode EditorSettings::mode = RMBMode::PanCameraMode;
-sf::Vector2u EditorSettings::levelSize;
-sf::Vector2f EditorSettings::RESOLUTION;
-
 int main(int argc, char** argv)
 {
 	util::Platform platform;
@@ -55,6 +58,9 @@ int main(int argc, char** argv)
 	MyContactListener contactListener;
 	world->SetContactListener(&contactListener);
 
+	/* Caps collision sounds however many impacts a step produces */
+	ImpactAggregator impactAggregator;
+
 	/* Instantiate b2ContactFilter */
 	//MyContactFilter filter;
 	//world->SetContactFilter(&filter);
@@ -67,6 +73,19 @@ int main(int argc, char** argv)
 	TriggerZone trigger(sf::Vector2f(100.f, 100.f), sf::Vector2f(100.f,100.f));
 	bool doQuery = false;
 
+	/* Trigger zones checked every frame (enter, stay and exit events) */
+	std::shared_ptr<TriggerZoneManager> triggerZoneManager(new TriggerZoneManager(world.get()));
+
+	int triggerOccupants = 0;
+	ZoneHandle triggerZone = triggerZoneManager->AddZone(trigger.GetAABB(),
+		[&](TriggerEventType type, ZoneHandle, std::uintptr_t)
+		{
+			if (type == TriggerEventType::Enter)
+				++triggerOccupants;
+			else if (type == TriggerEventType::Exit)
+				--triggerOccupants;
+		});
+
 	/* Create edge chain manager */
 	std::shared_ptr<EdgeChainManager> edgeChainManager(new EdgeChainManager(world.get()));
 
@@ -86,114 +105,188 @@ int main(int argc, char** argv)
 
 	sf::Clock clock;
 
+	/* Time not yet consumed by fixed physics steps */
+	float accumulator = 0.f;
+
+	/* Simulated time, for impact cooldowns */
+	float simulationTime = 0.f;
+
 	/* TMP */
 	//DebugBox box(sf::Vector2f(200.f, 200.f), &world);
 	bool forceOn = false;
 	bool torqueOn = false;
 
+	/* Frame profiler (scoped timers feed the ImGui "Profiler" window) */
+	std::shared_ptr<FrameProfiler> profiler = FrameProfiler::GetInstance();
+
+	/* Input (events and mouse position read once per frame) */
+	std::shared_ptr<InputManager> input = InputManager::GetInstance();
+
 	while (window.isOpen())
 	{
+		profiler->BeginFrame();
 		sf::Time dt = clock.restart();
 
-		sf::Event event;
-		while (window.pollEvent(event))
+		/* Poll events (mouse moves merged, mouse sampled once) */
 		{
-			// Process ImGui events
-			imguiManager->ProcessEvent(event);
+			ScopedTimer timer(ProfileScope::PollEvents);
+			input->Poll(window);
 
-			// Close window: exit
-            if (event.type == sf::Event::Closed)
-                window.close();
+			const sf::Vector2f mousePos = input->GetSnapshot().mouseWorld;
 
-			if (event.type == sf::Event::KeyReleased)
-            {
-				// Escape key: exit
-                if (event.key.code == sf::Keyboard::Escape)
-                    window.close();
+			for (const sf::Event& event : input->GetEvents())
+			{
+				// Process ImGui events
+				imguiManager->ProcessEvent(event);
 
-				// E key: toggle static edge shape
-				if (event.key.code == sf::Keyboard::E)
-				{
-					edgeChainManager->ToggleEnable();
-					edgeChainManager->SyncEnable();
-				}
+				// Close window: exit
+	            if (event.type == sf::Event::Closed)
+	                window.close();
 
-				// Space key: add new custom polygon
-				if (event.key.code == sf::Keyboard::Enter)
-				{
-					spriteManager->PushShape(ShapeType::CustomPolygon, GetMousePosition(window));
-				}
+				if (event.type == sf::Event::KeyReleased)
+	            {
+					// Escape key: exit
+	                if (event.key.code == sf::Keyboard::Escape)
+	                    window.close();
 
-				if (event.key.code == sf::Keyboard::Up) {
-					forceOn = !forceOn;
-				}
-				if (event.key.code == sf::Keyboard::Down) {
-					//box.ApplyLinearImpulse();
-				}
-				if (event.key.code == sf::Keyboard::Right) {
-					torqueOn = !torqueOn;
-				}
-				if (event.key.code == sf::Keyboard::Left) {
-					//box.ApplyAngularImpulse();
-				}
+					// E key: toggle static edge shape
+					if (event.key.code == sf::Keyboard::E)
+					{
+						edgeChainManager->ToggleEnable();
+						edgeChainManager->SyncEnable();
+					}
 
-				if (event.key.code == sf::Keyboard::Q)
-				{
-					/* Register b2QueryCallback */
-					doQuery = true;
-				}
-			}
+					// Space key: add new custom polygon
+					if (event.key.code == sf::Keyboard::Enter)
+					{
+						spriteManager->PushShape(ShapeType::CustomPolygon, mousePos);
+					}
 
-			// Left and right button release
-			if (event.type == sf::Event::MouseButtonReleased)
-			{
-				// Spawn a circle
-				if (event.mouseButton.button == sf::Mouse::Middle)
-				{
-					spriteManager->PushShape(ShapeType::DebugCircle, GetMousePosition(window));
-				}
-				else if (event.mouseButton.button == sf::Mouse::Right)
-				{
-					// Spawn a box
-					if (EditorSettings::mode == RMBMode::BoxSpawnMode)
+					if (event.key.code == sf::Keyboard::Up) {
+						forceOn = !forceOn;
+					}
+					if (event.key.code == sf::Keyboard::Down) {
+						//box.ApplyLinearImpulse();
+					}
+					if (event.key.code == sf::Keyboard::Right) {
+						torqueOn = !torqueOn;
+					}
+					if (event.key.code == sf::Keyboard::Left) {
+						//box.ApplyAngularImpulse();
+					}
+
+					if (event.key.code == sf::Keyboard::Q)
+					{
+						/* Register b2QueryCallback */
+						doQuery = true;
+					}
+
+					// T key: record a Chrome trace of frame timings
+					if (event.key.code == sf::Keyboard::T)
 					{
-						spriteManager->PushShape(ShapeType::DebugBox, GetMousePosition(window));
+						profiler->StartTrace(imguiManager->GetTraceSeconds());
 					}
 				}
-				else if (event.mouseButton.button == sf::Mouse::Left)
+
+				// Left and right button release
+				if (event.type == sf::Event::MouseButtonReleased)
 				{
-					edgeChainManager->CheckChainClicked(window);
+					// Spawn a circle
+					if (event.mouseButton.button == sf::Mouse::Middle)
+					{
+						spriteManager->PushShape(ShapeType::DebugCircle, mousePos);
+					}
+					else if (event.mouseButton.button == sf::Mouse::Right)
+					{
+						// Spawn a box
+						if (EditorSettings::mode == RMBMode::BoxSpawnMode)
+						{
+							spriteManager->PushShape(ShapeType::DebugBox, mousePos);
+						}
+					}
+					else if (event.mouseButton.button == sf::Mouse::Left)
+					{
+						edgeChainManager->CheckChainClicked(window);
+					}
 				}
-			}
 
-			// Handle grid inputs
-			grid->HandleInput(event, window);
+				// Handle grid inputs
+				grid->HandleInput(event, window);
 
-			// Handle manager inputs
-			cameraManager->HandleInput(event);
-			edgeChainManager->HandleInput(event, window);
-			spriteManager->HandleInput(event, window);
+				// Handle manager inputs
+				cameraManager->HandleInput(event, window);
+				edgeChainManager->HandleInput(event, window);
+				spriteManager->HandleInput(event, window);
 
-			// Handle triggers
-			trigger.HandleInput(event);
+				// Handle triggers
+				trigger.HandleInput(event);
 
-		}// end window.poll(event)
+			}// end input->GetEvents()
+		}
 
 		/* Update ImGui */
-		imguiManager->Update(window, dt);
+		{
+			ScopedTimer timer(ProfileScope::ImGuiUpdate);
+			imguiManager->Update(window, dt);
+		}
 
-		/* Update camera */
-		cameraManager->Update(window, dt);
+		/* Update tweens, then the camera they animate */
+		{
+			ScopedTimer timer(ProfileScope::CameraUpdate);
+			TweenManager::GetInstance()->Update(dt.asSeconds());
+			cameraManager->Update(window, dt);
+		}
 
 		/* Update dragging object cache */
 		DragCacheManager::UpdateCache();
 
-		/** Update Box2D */
-		world->Step(1/60.f, 8, 3);
+		/** Update Box2D (fixed time step) */
+		accumulator += dt.asSeconds();
+
+		int steps = 0;
+		while (accumulator >= TIME_STEP && steps < MAX_STEPS_PER_FRAME)
+		{
+			spriteManager->SaveTransforms();
+			contactListener.ClearEvents();
+			{
+				ScopedTimer timer(ProfileScope::WorldStep);
+				world->Step(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+			}
+			profiler->AddWorldProfile(world->GetProfile());
+
+			simulationTime += TIME_STEP;
+
+			/* Process contacts buffered during the step */
+			impactAggregator.Process(contactListener.GetEvents(), simulationTime);
+			/* for (const ImpactCue& cue : impactAggregator.GetCues())
+				MyPlayCollisionSound(cue); */
+			profiler->AddContactEvents((int)contactListener.GetEvents().size(),
+				(int)impactAggregator.GetImpactCount(), (int)impactAggregator.GetCues().size());
+			accumulator -= TIME_STEP;
+			++steps;
+		}
+
+		// Drop whole steps that could not be caught up on to avoid a
+		// spiral of ever longer frames
+		if (accumulator >= TIME_STEP)
+			accumulator = std::fmod(accumulator, TIME_STEP);
+
+		// Fraction of a step left over, used to blend rendered transforms
+		float alpha = accumulator / TIME_STEP;
 
 		/* Update managers */
-		edgeChainManager->Update(window);
-		spriteManager->Update();
+		{
+			ScopedTimer timer(ProfileScope::EdgeChainUpdate);
+			edgeChainManager->Update(window);
+		}
+		{
+			ScopedTimer timer(ProfileScope::SpriteUpdate);
+			spriteManager->Update(alpha);
+		}
+
+		/* World counters for trace export */
+		profiler->AddCounters(world->GetBodyCount(), world->GetContactCount(),
+			world->GetProxyCount());
 
 		if (doQuery)
 		{
@@ -204,30 +297,57 @@ int main(int argc, char** argv)
 		/* Update trigger zones */
 		trigger.Update(window);
 
+		triggerZoneManager->MoveZone(triggerZone, trigger.GetAABB());
+		triggerZoneManager->Update();
+		triggerZoneManager->DispatchCallbacks();
+		trigger.SetOccupied(triggerOccupants > 0);
+
 		/*----------------------------------------------------------------------
          Draw
          ----------------------------------------------------------------------*/
 		window.clear(sf::Color::White);
 
-		/* Draw grid */
-		grid->Draw(window);
+		/* Draw grid (tiles are picked from the camera view, labels use the HUD view) */
+		window.setView(cameraManager->GetCameraView());
+		{
+			ScopedTimer timer(ProfileScope::DrawGrid);
+			grid->Draw(window);
+		}
 
 		window.setView(cameraManager->GetCameraView());
 
 		/* Render triggers */
-		trigger.Draw(window);
+		{
+			ScopedTimer timer(ProfileScope::DrawTriggers);
+			trigger.Draw(window);
+		}
 
 		/* Draw objects */
-		spriteManager->Draw(window);
-		edgeChainManager->Draw(window);
-
-		if (imguiManager->RenderMouseCoords())
-			grid->DrawMouseLabel(window);
+		{
+			ScopedTimer timer(ProfileScope::DrawSprites);
+			spriteManager->Draw(window);
+		}
+		{
+			ScopedTimer timer(ProfileScope::DrawEdgeChains);
+			edgeChainManager->Draw(window);
+		}
 
 		// Render ImGui windows
-		imguiManager->Render(window);
+		{
+			ScopedTimer timer(ProfileScope::DrawImGui);
+
+			if (imguiManager->RenderMouseCoords())
+				grid->DrawMouseLabel(window);
+
+			imguiManager->Render(window);
+		}
+
+		{
+			ScopedTimer timer(ProfileScope::Display);
+			window.display();
+		}
 
-		window.display();
+		profiler->EndFrame();
 	}
 
 	// clean up ImGui, such as deleting the internal font atlas
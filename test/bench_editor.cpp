@@ -0,0 +1,203 @@
+#include <catch2/catch.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/grid.hpp"
+#include "editor/animation/easing.hpp"
+#include "editor/animation/easing_table.hpp"
+#include "editor/animation/interpolate.hpp"
+#include "editor/animation/tween.hpp"
+#include "editor/managers/tween_manager.hpp"
+#include "editor/chains/static_edge_chain.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+/** Editor benchmarks
+ *
+ * Hidden by default. Run with:
+ *   tests_<name> "[benchmark]" -r xml -o bench.xml
+ */
+
+using sf::Vector2f;
+
+TEST_CASE("Grid::PrepareTiles at the smallest unit size", "[.][benchmark][grid]")
+{
+	Grid grid(Vector2f(1728.f, 810.f), Vector2f(3456.f, 1620.f));
+	grid.SetType(GridType::CROSS_HAIR);
+
+	sf::FloatRect view(0.f, 0.f, 1728.f, 810.f);
+
+	// SetUnitSize drops the cached tiles, so every call rebuilds the view
+	BENCHMARK("Cross hair grid, unit size 10, cold view")
+	{
+		grid.SetUnitSize(10.f);
+		grid.PrepareTiles(view);
+		return grid.GetCachedTileCount();
+	};
+
+	// Panning across already cached tiles
+	BENCHMARK("Cross hair grid, unit size 10, cached pan")
+	{
+		view.left = view.left > 1000.f ? 0.f : view.left + 8.f;
+		grid.PrepareTiles(view);
+		return grid.GetCachedTileCount();
+	};
+
+	// Whole level in view at a tenth of its size; LOD keeps the tile count down
+	BENCHMARK("Cross hair grid, unit size 10, zoomed out x10")
+	{
+		grid.SetUnitSize(10.f);
+		grid.PrepareTiles(sf::FloatRect(0.f, 0.f, 3456.f, 1620.f), grid.GetDetailLevel(.1f));
+		return grid.GetCachedTileCount();
+	};
+}
+
+TEST_CASE("StaticEdgeChain::BuildBody on a 10k vertex chain", "[.][benchmark][chains]")
+{
+	std::vector<Vector2f> vertices(10000);
+	for (std::size_t i = 0; i < vertices.size(); ++i)
+		vertices[i] = Vector2f(i * 5.f, 800.f + std::sin(i * .05f) * 100.f);
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	StaticEdgeChain chain(vertices, Vector2f(0.f, 0.f), "Bench", &world, nullptr);
+
+	BENCHMARK("Rebuild 10000 vertex chain")
+	{
+		chain.BuildBody(&world);
+		return world.GetBodyCount();
+	};
+
+	chain.DeleteBody(&world);
+}
+
+TEST_CASE("Easing dispatch across all easing functions", "[.][benchmark][tween]")
+{
+	constexpr int FUNCTION_COUNT = static_cast<int>(InterpFunc::BounceEaseInOut) + 1;
+	constexpr int FRAMES = 60;
+
+	// A one second animation sampled at 60 fps, evaluated the way
+	// Tween::Update does: start + change * curve(elapsed / duration)
+	std::vector<float> samples;
+	for (int frame = 1; frame < FRAMES; ++frame)
+		samples.push_back(frame / float(FRAMES));
+
+	for (int i = 0; i < FUNCTION_COUNT; ++i)
+	{
+		InterpFunc function = static_cast<InterpFunc>(i);
+
+		// Before: switch on the function for every sample
+		BENCHMARK("Interpolate::Evaluate InterpFunc " + std::to_string(i))
+		{
+			float sum = 0.f;
+			for (float t : samples)
+				sum += Interpolate::Evaluate(function, t, 0.f, 100.f, 1.f);
+			return sum;
+		};
+
+		// After: curve resolved once, as when a tween is created
+		EaseFunc ease = GetEaseFunc(function);
+
+		BENCHMARK("EaseFunc InterpFunc " + std::to_string(i))
+		{
+			float sum = 0.f;
+			for (float t : samples)
+				sum += 0.f + 100.f * ease(t / 1.f);
+			return sum;
+		};
+	}
+}
+
+TEST_CASE("EaseBatch against scalar easing", "[.][benchmark][tween]")
+{
+	constexpr std::size_t COUNT = 512;
+
+	std::vector<float> t(COUNT), b(COUNT, 0.f), c(COUNT, 100.f), d(COUNT, 1.f), out(COUNT);
+	for (std::size_t i = 0; i < COUNT; ++i)
+		t[i] = i / float(COUNT);
+
+	// Vectorised polynomials, a piecewise curve and a per-lane fallback
+	const InterpFunc functions[] = {
+		InterpFunc::QuartEaseOut,
+		InterpFunc::BackEaseInOut,
+		InterpFunc::BounceEaseOut,
+		InterpFunc::ExpoEaseOut
+	};
+
+	for (InterpFunc function : functions)
+	{
+		std::string name = std::to_string(static_cast<int>(function));
+		EaseFunc ease = GetEaseFunc(function);
+
+		BENCHMARK("Scalar, 512 values, InterpFunc " + name)
+		{
+			for (std::size_t i = 0; i < COUNT; ++i)
+				out[i] = b[i] + c[i] * ease(t[i] / d[i]);
+			return out[COUNT - 1];
+		};
+
+		BENCHMARK("EaseBatch x" + std::to_string(GetEaseBatchLanes()) + ", 512 values, InterpFunc " + name)
+		{
+			EaseBatch(function, t.data(), b.data(), c.data(), d.data(), out.data(), COUNT);
+			return out[COUNT - 1];
+		};
+	}
+}
+
+TEST_CASE("EasingTable against analytic easing", "[.][benchmark][tween]")
+{
+	constexpr std::size_t COUNT = 512;
+
+	std::vector<float> t(COUNT), b(COUNT, 0.f), c(COUNT, 100.f), d(COUNT, 1.f), out(COUNT);
+	for (std::size_t i = 0; i < COUNT; ++i)
+		t[i] = i / float(COUNT);
+
+	// Curves that call sin, exp2 or branch per evaluation
+	const InterpFunc functions[] = {
+		InterpFunc::SineEaseInOut,
+		InterpFunc::BackEaseInOut,
+		InterpFunc::ElasticEaseOut,
+		InterpFunc::BounceEaseInOut
+	};
+
+	for (InterpFunc function : functions)
+	{
+		std::string name = std::to_string(static_cast<int>(function));
+		EasingTable table(function);
+
+		BENCHMARK("EaseBatch, 512 values, InterpFunc " + name)
+		{
+			EaseBatch(function, t.data(), b.data(), c.data(), d.data(), out.data(), COUNT);
+			return out[COUNT - 1];
+		};
+
+		BENCHMARK("EasingTable, 512 values, InterpFunc " + name)
+		{
+			table.EvaluateBatch(t.data(), b.data(), c.data(), d.data(), out.data(), COUNT);
+			return out[COUNT - 1];
+		};
+	}
+}
+
+TEST_CASE("TweenManager::Update with a full pool", "[.][benchmark][tween]")
+{
+	constexpr int FUNCTION_COUNT = static_cast<int>(InterpFunc::BounceEaseInOut) + 1;
+
+	auto tweens = TweenManager::GetInstance();
+	std::vector<float> values(TweenManager::MAX_TWEENS, 0.f);
+
+	// Durations long enough that nothing finishes during the run
+	BENCHMARK_ADVANCED("Update 512 tweens")(Catch::Benchmark::Chronometer meter)
+	{
+		tweens->StopAll();
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			tweens->Spawn(&values[i], 0.f, 100.f, 1000.f,
+				static_cast<InterpFunc>(i % FUNCTION_COUNT));
+		}
+
+		meter.measure([&] { tweens->Update(1.f / 60.f); });
+	};
+
+	tweens->StopAll();
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+#include <catch2/catch.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/constants.hpp"
+#include "editor/managers/edge_chain_manager.hpp"
+#include "editor/managers/sprite_manager.hpp"
+#include "editor/managers/trigger_zone_manager.hpp"
+#include "editor/callbacks/ray_query.hpp"
+#include "editor/callbacks/parallel_query.hpp"
+
+/** Physics benchmarks
+ *
+ * Hidden by default. Run with:
+ *   tests_<name> "[benchmark]" -r xml -o bench.xml
+ */
+
+using sf::Vector2f;
+
+namespace
+{
+	constexpr int COLUMNS = 18;
+	constexpr float SPACING = 34.f;
+
+	void SetBenchLevel()
+	{
+		EditorSettings::RESOLUTION = Vector2f(1728.f, 810.f);
+		EditorSettings::levelSize = sf::Vector2u(3456, 1620);
+	}
+
+	/* Rows of shapes stacked upwards from the floor of the demo chains.
+	   Large counts spill over the chain walls, which keeps plenty of
+	   contacts active while stepping. */
+	void PileShapes(SpriteManager& sprites, ShapeType type, int count,
+		float top = 470.f)
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			Vector2f position(130.f + (i % COLUMNS) * SPACING,
+				top - (i / COLUMNS) * SPACING);
+			sprites.PushShape(type, position);
+		}
+	}
+
+	void StepWorld(b2World& world, int steps)
+	{
+		for (int i = 0; i < steps; ++i)
+			world.Step(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+	}
+}
+
+TEST_CASE("b2World::Step with piled DebugBoxes", "[.][benchmark][physics]")
+{
+	SetBenchLevel();
+
+	for (int count : {1000, 5000, 20000})
+	{
+		b2World world(b2Vec2(0.f, 9.8f));
+		EdgeChainManager chains(&world);
+		SpriteManager sprites(&world);
+
+		PileShapes(sprites, ShapeType::DebugBox, count);
+
+		// Let the pile collapse so contacts are established
+		StepWorld(world, 30);
+
+		BENCHMARK("Step " + std::to_string(count) + " boxes")
+		{
+			world.Step(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+			return world.GetContactCount();
+		};
+	}
+}
+
+TEST_CASE("SpriteManager update and draw preparation", "[.][benchmark][sprites]")
+{
+	SetBenchLevel();
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	EdgeChainManager chains(&world);
+	SpriteManager sprites(&world);
+
+	// Mixed shape types, spread over the level so none are culled
+	const ShapeType types[] = {
+		ShapeType::DebugBox, ShapeType::DebugCircle,
+		ShapeType::CustomPolygon, ShapeType::MultiShape
+	};
+
+	for (int i = 0; i < 4000; ++i)
+	{
+		Vector2f position(200.f + (i % 90) * 36.f, 100.f + (i / 90) * 34.f);
+		sprites.PushShape(types[i % 4], position);
+	}
+
+	sprites.SaveTransforms();
+	StepWorld(world, 10);
+
+	// Positions don't change between runs, so the population is stable
+	BENCHMARK("SpriteManager::Update 4000 mixed")
+	{
+		sprites.Update(.5f);
+		return SpriteManager::DynamicBodiesCount;
+	};
+
+	BENCHMARK("SpriteManager::PrepareDraw 4000 mixed")
+	{
+		sprites.PrepareDraw();
+		return sprites.GetBatch().GetTriangleVertexCount();
+	};
+
+	// A view covering a quarter of the level
+	const sf::FloatRect visibleArea(864.f, 405.f, 1728.f, 810.f);
+
+	BENCHMARK("SpriteManager::PrepareDraw 4000 mixed, culled")
+	{
+		sprites.PrepareDraw(visibleArea);
+		return sprites.GetBatch().GetTriangleVertexCount();
+	};
+}
+
+TEST_CASE("SpriteManager update with a settled pile", "[.][benchmark][sprites]")
+{
+	SetBenchLevel();
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	EdgeChainManager chains(&world);
+	SpriteManager sprites(&world);
+
+	PileShapes(sprites, ShapeType::DebugBox, 300);
+
+	// Ten seconds is enough for the pile to fall asleep
+	for (int i = 0; i < 600; ++i)
+	{
+		sprites.SaveTransforms();
+		world.Step(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+		sprites.Update(1.f);
+	}
+
+	// Sleeping shapes keep their cached geometry
+	BENCHMARK("SpriteManager::Update settled pile")
+	{
+		sprites.Update(1.f);
+		return sprites.GetActiveShapeCount();
+	};
+}
+
+TEST_CASE("SpriteManager spawn and despawn churn", "[.][benchmark][sprites]")
+{
+	SetBenchLevel();
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	SpriteManager sprites(&world);
+
+	// After the first run every slot and tag is reused
+	BENCHMARK("Spawn and clear 1000 mixed")
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			ShapeType type = static_cast<ShapeType>(1 + i % 4);
+			sprites.PushShape(type, Vector2f(200.f + (i % 90) * 36.f, 400.f));
+		}
+
+		sprites.DestroyAllShapes();
+		return world.GetBodyCount();
+	};
+}
+
+TEST_CASE("TriggerZoneManager with many zones", "[.][benchmark][triggers]")
+{
+	SetBenchLevel();
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	EdgeChainManager chains(&world);
+	SpriteManager sprites(&world);
+
+	PileShapes(sprites, ShapeType::DebugBox, 2000);
+	StepWorld(world, 30);
+
+	// Grid of small zones over the whole level
+	TriggerZoneManager zones(&world);
+	const float levelWidth = 3456.f / SCALE;
+	const float levelHeight = 1620.f / SCALE;
+
+	for (int i = 0; i < 5000; ++i)
+	{
+		b2AABB aabb;
+		aabb.lowerBound.Set((i % 100) * levelWidth / 100.f, (i / 100) * levelHeight / 50.f);
+		aabb.upperBound = aabb.lowerBound + b2Vec2(.5f, .5f);
+		zones.AddZone(aabb);
+	}
+
+	zones.Update();
+
+	BENCHMARK("Step and update 5000 zones, 2000 boxes")
+	{
+		world.Step(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+		zones.Update();
+		return zones.GetStayEvents().size();
+	};
+}
+
+TEST_CASE("RayQueryBatch sight lines", "[.][benchmark][rays]")
+{
+	SetBenchLevel();
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	EdgeChainManager chains(&world);
+	SpriteManager sprites(&world);
+
+	PileShapes(sprites, ShapeType::DebugBox, 2000);
+	StepWorld(world, 30);
+
+	// Fan of rays from above the pile down into it
+	RayQueryBatch batch;
+	batch.Reserve(500, 500 * RayQueryBatch::MAX_HITS_PER_RAY);
+
+	const b2Vec2 origin(400.f / SCALE, 50.f / SCALE);
+
+	for (RayQueryMode mode : {RayQueryMode::Closest, RayQueryMode::Any, RayQueryMode::All})
+	{
+		const char* name = mode == RayQueryMode::Closest ? "closest" :
+			mode == RayQueryMode::Any ? "any" : "all";
+
+		BENCHMARK(std::string("500 rays, ") + name)
+		{
+			batch.Clear();
+			for (int i = 0; i < 500; ++i)
+			{
+				b2Vec2 end(i * 3456.f / 500.f / SCALE, 1620.f / SCALE);
+				batch.AddRay(origin, end, mode);
+			}
+
+			batch.Execute(&world);
+			return batch.GetHits().size();
+		};
+	}
+}
+
+TEST_CASE("ParallelQueryBatch line of sight scaling", "[.][benchmark][rays][threads]")
+{
+	SetBenchLevel();
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	EdgeChainManager chains(&world);
+	SpriteManager sprites(&world);
+
+	PileShapes(sprites, ShapeType::DebugBox, 2000);
+	StepWorld(world, 30);
+
+	// Agents spread over the level, each looking at a fixed target
+	ParallelQueryBatch batch;
+	const b2Vec2 target(1728.f / SCALE, 400.f / SCALE);
+
+	for (int i = 0; i < 5000; ++i)
+	{
+		b2Vec2 agent((i % 100) * 3456.f / 100.f / SCALE, (i / 100) * 1620.f / 50.f / SCALE);
+		batch.AddRay(agent, target, RayQueryMode::Any);
+	}
+
+	for (size_t threads : {size_t(0), size_t(1), size_t(3), WorkerPool::GetDefaultThreadCount()})
+	{
+		WorkerPool pool(threads);
+
+		BENCHMARK("5000 sight lines, " + std::to_string(threads + 1) + " threads")
+		{
+			batch.Execute(&world, pool);
+			return batch.GetRayHits().size();
+		};
+	}
+}
+
+TEST_CASE("SpriteManager test point picking", "[.][benchmark][sprites]")
+{
+	SetBenchLevel();
+
+	for (int count : {20, 20000})
+	{
+		b2World world(b2Vec2(0.f, 9.8f));
+		EdgeChainManager chains(&world);
+		SpriteManager sprites(&world);
+
+		PileShapes(sprites, ShapeType::DebugBox, count);
+		StepWorld(world, 30);
+		sprites.Update(1.f);
+
+		// Cursor sweeping over the bottom of the pile
+		int frame = 0;
+		BENCHMARK("DoTestPoint " + std::to_string(count) + " boxes")
+		{
+			Vector2f cursor(130.f + (frame++ % COLUMNS) * SPACING, 460.f);
+			sprites.DoTestPoint(cursor);
+			return sprites.GetHighlightedShapeCount();
+		};
+
+		sprites.ResetTestPoint();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <catch2/catch.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/constants.hpp"
+#include "editor/tag_registry.hpp"
+#include "editor/managers/sprite_manager.hpp"
+
+TEST_CASE("BodyUserData packs and unpacks an owner", "[userdata]")
+{
+	BodyUserData owner;
+	owner.tagId = TagRegistry::GetInstance()->Register("debug_box");
+	owner.slot = BodyUserData::MAX_SLOT;
+	owner.generation = BodyUserData::MAX_GENERATION;
+
+	BodyUserData result;
+	REQUIRE(BodyUserData::Unpack(owner.Pack(), result));
+	REQUIRE(result.tagId == owner.tagId);
+	REQUIRE(result.slot == BodyUserData::MAX_SLOT);
+	REQUIRE(result.generation == BodyUserData::MAX_GENERATION);
+
+	// Generations wrap without ever reaching 0
+	REQUIRE(BodyUserData::NextGeneration(BodyUserData::MAX_GENERATION) == 1);
+
+	// Bodies without an owner keep a zero pointer
+	REQUIRE_FALSE(BodyUserData::Unpack(b2BodyUserData(), result));
+}
+
+TEST_CASE("TagRegistry interns tags", "[userdata]")
+{
+	auto registry = TagRegistry::GetInstance();
+
+	TagId id = registry->Register("test_tag");
+	REQUIRE(id != TagRegistry::NO_TAG);
+	REQUIRE(registry->Register("test_tag") == id);
+	REQUIRE(registry->Find("test_tag") == id);
+	REQUIRE(registry->GetTag(id) == "test_tag");
+	REQUIRE(registry->Find("missing_tag") == TagRegistry::NO_TAG);
+}
+
+TEST_CASE("SpriteManager keeps owners stable across removal", "[userdata]")
+{
+	EditorSettings::levelSize = sf::Vector2u(1000, 1000);
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	SpriteManager sprites(&world);
+
+	// The first box is outside the level and is removed on Update,
+	// so the last box is moved into its array slot
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(-500.f, 100.f));
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(100.f, 100.f));
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(200.f, 100.f));
+	sprites.PushShape(ShapeType::DebugCircle, sf::Vector2f(300.f, 100.f));
+
+	std::vector<std::pair<b2Body*, uintptr_t>> owners;
+	for (b2Body* body = world.GetBodyList(); body; body = body->GetNext())
+		owners.emplace_back(body, body->GetUserData().pointer);
+
+	sprites.Update(1.f);
+
+	// Survivors keep their packed owner, the removed shape's goes stale
+	int owned = 0;
+	uintptr_t removedOwner = 0;
+	for (const auto& owner : owners)
+	{
+		DebugShape* shape = sprites.GetShape(owner.second);
+		if (shape == nullptr)
+		{
+			removedOwner = owner.second;
+			continue;
+		}
+
+		REQUIRE(shape->GetBody() == owner.first);
+		REQUIRE(owner.first->GetUserData().pointer == owner.second);
+		REQUIRE(sprites.GetShape(owner.first) == shape);
+		++owned;
+	}
+
+	REQUIRE(owned == 3);
+	REQUIRE(removedOwner != 0);
+
+	// A new shape reuses the owner slot under a new generation
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(400.f, 100.f));
+	REQUIRE(sprites.GetShape(removedOwner) == nullptr);
+
+	sprites.DestroyAllShapes();
+}
+
+TEST_CASE("SpriteManager picks shapes under a point", "[userdata]")
+{
+	EditorSettings::levelSize = sf::Vector2u(1000, 1000);
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	SpriteManager sprites(&world);
+
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(100.f, 100.f));
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(300.f, 100.f));
+
+	sprites.DoTestPoint(sf::Vector2f(100.f, 100.f));
+	REQUIRE(sprites.GetHighlightedShapeCount() == 1);
+
+	sprites.DoTestPoint(sf::Vector2f(300.f, 100.f));
+	REQUIRE(sprites.GetHighlightedShapeCount() == 1);
+
+	sprites.DoTestPoint(sf::Vector2f(200.f, 100.f));
+	REQUIRE(sprites.GetHighlightedShapeCount() == 0);
+
+	sprites.DoTestPoint(sf::Vector2f(100.f, 100.f));
+	sprites.ResetTestPoint();
+	REQUIRE(sprites.GetHighlightedShapeCount() == 0);
+
+	sprites.DestroyAllShapes();
+}
+
+TEST_CASE("SpriteManager keeps highlights across removal", "[userdata]")
+{
+	EditorSettings::levelSize = sf::Vector2u(1000, 1000);
+
+	b2World world(b2Vec2(0.f, 9.8f));
+	SpriteManager sprites(&world);
+
+	// The last box is highlighted and moved into the removed box's slot
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(-500.f, 100.f));
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(100.f, 100.f));
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(200.f, 100.f));
+
+	sprites.DoTestPoint(sf::Vector2f(200.f, 100.f));
+	REQUIRE(sprites.GetHighlightedShapeCount() == 1);
+
+	sprites.Update(1.f);
+	REQUIRE(sprites.GetHighlightedShapeCount() == 1);
+
+	// A highlighted shape that is removed drops its highlight
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(-500.f, 300.f));
+	sprites.DoTestPoint(sf::Vector2f(-500.f, 300.f));
+	REQUIRE(sprites.GetHighlightedShapeCount() == 1);
+
+	sprites.Update(1.f);
+	REQUIRE(sprites.GetHighlightedShapeCount() == 0);
+
+	sprites.DestroyAllShapes();
+}
\ No newline at end of file
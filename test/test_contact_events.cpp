@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/callbacks/my_contact_listener.hpp"
+
+namespace
+{
+	/* Ball falling onto a static ground box */
+	b2Body* CreateScene(b2World& world, float fallSpeed)
+	{
+		b2BodyDef groundDef;
+		b2Body* ground = world.CreateBody(&groundDef);
+
+		b2PolygonShape groundShape;
+		groundShape.SetAsBox(10.f, .5f);
+		ground->CreateFixture(&groundShape, 0.f);
+
+		b2BodyDef ballDef;
+		ballDef.type = b2_dynamicBody;
+		ballDef.position.Set(0.f, -1.5f);
+		ballDef.linearVelocity.Set(0.f, fallSpeed);
+		ballDef.userData.pointer = 42;
+		b2Body* ball = world.CreateBody(&ballDef);
+
+		b2CircleShape ballShape;
+		ballShape.m_radius = .5f;
+		ball->CreateFixture(&ballShape, 1.f);
+
+		return ball;
+	}
+}
+
+TEST_CASE("MyContactListener buffers contact events", "[contacts]")
+{
+	b2World world(b2Vec2(0.f, 9.8f));
+	MyContactListener listener;
+	world.SetContactListener(&listener);
+
+	CreateScene(world, 10.f);
+
+	bool begin = false;
+	bool impact = false;
+
+	for (int i = 0; i < 60 && !impact; ++i)
+	{
+		listener.ClearEvents();
+		world.Step(1.f / 60.f, 8, 3);
+
+		for (const ContactEvent& event : listener.GetEvents())
+		{
+			REQUIRE((event.ownerA == 42 || event.ownerB == 42));
+
+			if (event.type == ContactEventType::Begin)
+				begin = true;
+			else if (event.type == ContactEventType::Impact)
+			{
+				impact = true;
+				REQUIRE(event.approachSpeed > MyContactListener::IMPACT_SPEED);
+				REQUIRE(event.normalImpulse > 0.f);
+			}
+		}
+	}
+
+	REQUIRE(begin);
+	REQUIRE(impact);
+}
+
+TEST_CASE("ContactEventBuffer drops events past its capacity", "[contacts]")
+{
+	b2World world(b2Vec2(0.f, 9.8f));
+	MyContactListener listener(1);
+	world.SetContactListener(&listener);
+
+	CreateScene(world, 10.f);
+
+	size_t dropped = 0;
+	for (int i = 0; i < 60; ++i)
+	{
+		listener.ClearEvents();
+		world.Step(1.f / 60.f, 8, 3);
+
+		REQUIRE(listener.GetEvents().size() <= 1);
+		dropped += listener.GetEvents().GetDroppedCount();
+	}
+
+	// Begin and impact land on the same step, so one is dropped
+	REQUIRE(dropped > 0);
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <catch2/catch.hpp>
+
+#include "editor/animation/easing.hpp"
+#include "editor/animation/easing_table.hpp"
+#include "editor/animation/interpolate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+	constexpr int FUNCTION_COUNT = static_cast<int>(InterpFunc::BounceEaseInOut) + 1;
+}
+
+TEST_CASE("Resolved easing curves match the Interpolate functions", "[tween]")
+{
+	for (int i = 0; i < FUNCTION_COUNT; ++i)
+	{
+		InterpFunc function = static_cast<InterpFunc>(i);
+		EaseFunc ease = GetEaseFunc(function);
+
+		INFO("InterpFunc " + std::to_string(i));
+
+		REQUIRE(ease(0.f) == Approx(0.f).margin(1e-6));
+		REQUIRE(ease(1.f) == Approx(1.f).margin(1e-6));
+
+		// Interior samples only; some four-argument curves don't snap at 0 or 1
+		for (int sample = 1; sample < 100; ++sample)
+		{
+			float t = sample / 100.f;
+			REQUIRE(ease(t) == Approx(Interpolate::Evaluate(function, t, 0.f, 1.f, 1.f)).margin(1e-5));
+		}
+	}
+}
+
+TEST_CASE("EaseBatch matches the scalar curves", "[tween]")
+{
+	// Not a multiple of 8 so the scalar tail runs too; a few samples sit
+	// outside the duration to check clamping
+	constexpr std::size_t COUNT = 37;
+
+	std::vector<float> t(COUNT), b(COUNT), c(COUNT), d(COUNT), out(COUNT);
+	for (std::size_t i = 0; i < COUNT; ++i)
+	{
+		t[i] = i * .07f - .2f;
+		b[i] = i * 3.f;
+		c[i] = 50.f - i * 4.f;
+		d[i] = 1.f + (i % 3) * .5f;
+	}
+
+	for (int i = 0; i < FUNCTION_COUNT; ++i)
+	{
+		InterpFunc function = static_cast<InterpFunc>(i);
+		EaseFunc ease = GetEaseFunc(function);
+
+		INFO("InterpFunc " + std::to_string(i));
+
+		EaseBatch(function, t.data(), b.data(), c.data(), d.data(), out.data(), COUNT);
+
+		for (std::size_t j = 0; j < COUNT; ++j)
+		{
+			float progress = std::min(std::max(t[j] / d[j], 0.f), 1.f);
+			REQUIRE(out[j] == Approx(b[j] + c[j] * ease(progress)).margin(1e-4));
+		}
+	}
+}
+
+TEST_CASE("EasingTable stays within its error bound", "[tween]")
+{
+	constexpr int SAMPLES = 10000;
+
+	for (int i = 0; i < FUNCTION_COUNT; ++i)
+	{
+		InterpFunc function = static_cast<InterpFunc>(i);
+		EaseFunc ease = GetEaseFunc(function);
+
+		INFO("InterpFunc " + std::to_string(i));
+
+		EasingTable table(function);
+		EasingTable fineTable(function, EasingTable::DEFAULT_RESOLUTION * 4);
+
+		// Circular curves have an infinite slope at an end or the midpoint
+		bool circular = function == InterpFunc::CircEaseIn ||
+			function == InterpFunc::CircEaseOut || function == InterpFunc::CircEaseInOut;
+		float bound = circular ? .03f : .01f;
+
+		float error = 0.f;
+		float fineError = 0.f;
+
+		for (int sample = 0; sample <= SAMPLES; ++sample)
+		{
+			float t = sample / float(SAMPLES);
+			error = std::max(error, std::abs(table.Evaluate(t) - ease(t)));
+			fineError = std::max(fineError, std::abs(fineTable.Evaluate(t) - ease(t)));
+		}
+
+		REQUIRE(error < bound);
+		REQUIRE(fineError <= error);
+
+		// End points are samples, so finished tweens land exactly
+		REQUIRE(table.Evaluate(0.f) == ease(0.f));
+		REQUIRE(table.Evaluate(1.f) == ease(1.f));
+	}
+}
\ No newline at end of file
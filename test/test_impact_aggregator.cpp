@@ -0,0 +1,112 @@
+#include <catch2/catch.hpp>
+#include "editor/callbacks/impact_aggregator.hpp"
+#include "editor/debug/body_user_data.hpp"
+
+namespace
+{
+	ContactEvent MakeImpact(float x, float y, float speed, std::uintptr_t ownerA,
+		std::uintptr_t ownerB = 0)
+	{
+		ContactEvent event = ContactEvent();
+		event.type = ContactEventType::Impact;
+		event.ownerA = ownerA;
+		event.ownerB = ownerB;
+		event.point.x = x;
+		event.point.y = y;
+		event.approachSpeed = speed;
+		return event;
+	}
+}
+
+TEST_CASE("ImpactAggregator bounds the cue count", "[contacts]")
+{
+	ImpactAggregatorSettings settings;
+	settings.maxCues = 8;
+	ImpactAggregator aggregator(settings);
+
+	// A pile landing: thousands of impacts spread over many regions
+	std::vector<ContactEvent> events;
+	for (int i = 0; i < 5000; ++i)
+		events.push_back(MakeImpact((i % 100) * .5f, (i / 100) * .5f, 2.f + i % 7, i + 1));
+
+	aggregator.Process(events.data(), events.size(), 0.f);
+
+	const auto& cues = aggregator.GetCues();
+	REQUIRE(aggregator.GetImpactCount() == events.size());
+	REQUIRE(cues.size() == settings.maxCues);
+
+	// Strongest first
+	for (size_t i = 1; i < cues.size(); ++i)
+		REQUIRE(cues[i - 1].energy >= cues[i].energy);
+}
+
+TEST_CASE("ImpactAggregator keeps the strongest impacts per region", "[contacts]")
+{
+	ImpactAggregatorSettings settings;
+	settings.maxPerCell = 1;
+	ImpactAggregator aggregator(settings);
+
+	ContactEvent events[] = {
+		MakeImpact(.1f, .1f, 2.f, 1),
+		MakeImpact(.2f, .2f, 5.f, 2),
+		MakeImpact(.3f, .3f, 3.f, 3),
+		MakeImpact(4.5f, .5f, 2.f, 4)
+	};
+
+	aggregator.Process(events, 4, 0.f);
+
+	const auto& cues = aggregator.GetCues();
+	REQUIRE(cues.size() == 2);
+	REQUIRE(cues[0].ownerA == 2);
+	REQUIRE(cues[0].count == 3);
+	REQUIRE(cues[1].ownerA == 4);
+}
+
+TEST_CASE("ImpactAggregator applies region and body cooldowns", "[contacts]")
+{
+	ImpactAggregatorSettings settings;
+	settings.cellWindow = .1f;
+	settings.bodyCooldown = .5f;
+	ImpactAggregator aggregator(settings);
+
+	ContactEvent first = MakeImpact(0.f, 0.f, 3.f, 1);
+	aggregator.Process(&first, 1, 0.f);
+	REQUIRE(aggregator.GetCues().size() == 1);
+
+	// Same region inside the window
+	aggregator.Process(&first, 1, .05f);
+	REQUIRE(aggregator.GetCues().empty());
+
+	// New region, but the body is still cooling down
+	ContactEvent moved = MakeImpact(10.f, 0.f, 3.f, 1);
+	aggregator.Process(&moved, 1, .2f);
+	REQUIRE(aggregator.GetCues().empty());
+
+	// A fresh body in the same impact is enough
+	ContactEvent pair = MakeImpact(10.f, 0.f, 3.f, 1, 2);
+	aggregator.Process(&pair, 1, .2f);
+	REQUIRE(aggregator.GetCues().size() == 1);
+
+	aggregator.Process(&moved, 1, 1.f);
+	REQUIRE(aggregator.GetCues().size() == 1);
+}
+
+TEST_CASE("ImpactAggregator does not carry cooldowns into reused owner slots", "[contacts]")
+{
+	ImpactAggregatorSettings settings;
+	settings.cellWindow = 0.f;
+	settings.bodyCooldown = .5f;
+	ImpactAggregator aggregator(settings);
+
+	BodyUserData owner = { TagRegistry::NO_TAG, 3, 1 };
+	ContactEvent removed = MakeImpact(0.f, 0.f, 3.f, owner.Pack().pointer);
+	aggregator.Process(&removed, 1, 0.f);
+	REQUIRE(aggregator.GetCues().size() == 1);
+
+	// A body spawned into the removed body's owner slot gets the next
+	// generation, so it must not inherit the cooldown
+	owner.generation = BodyUserData::NextGeneration(owner.generation);
+	ContactEvent spawned = MakeImpact(10.f, 0.f, 3.f, owner.Pack().pointer);
+	aggregator.Process(&spawned, 1, .1f);
+	REQUIRE(aggregator.GetCues().size() == 1);
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <catch2/catch.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/worker_pool.hpp"
+#include "editor/callbacks/parallel_query.hpp"
+
+TEST_CASE("WorkerPool covers every index once", "[threads]")
+{
+	for (size_t threads : {0, 1, 3})
+	{
+		WorkerPool pool(threads);
+		REQUIRE(pool.GetWorkerCount() == threads + 1);
+
+		std::vector<int> visits(10000, 0);
+		std::vector<size_t> workers(visits.size(), 0);
+
+		// Several dispatches on the same pool
+		for (int run = 0; run < 3; ++run)
+		{
+			pool.ParallelFor(visits.size(), 37,
+				[&](size_t begin, size_t end, size_t worker)
+				{
+					for (size_t i = begin; i < end; ++i)
+					{
+						++visits[i];
+						workers[i] = worker;
+					}
+				});
+		}
+
+		for (size_t i = 0; i < visits.size(); ++i)
+		{
+			REQUIRE(visits[i] == 3);
+			REQUIRE(workers[i] < pool.GetWorkerCount());
+		}
+	}
+}
+
+TEST_CASE("ParallelQueryBatch matches serial queries", "[threads][rays]")
+{
+	b2World world(b2Vec2(0.f, 0.f));
+
+	// Grid of boxes
+	for (int y = 0; y < 10; ++y)
+	{
+		for (int x = 0; x < 10; ++x)
+		{
+			b2BodyDef def;
+			def.position.Set(x * 2.f, y * 2.f);
+			b2Body* body = world.CreateBody(&def);
+
+			b2PolygonShape shape;
+			shape.SetAsBox(.5f, .5f);
+			body->CreateFixture(&shape, 0.f);
+		}
+	}
+
+	WorkerPool pool(3);
+	ParallelQueryBatch parallel;
+	RayQueryBatch serial;
+
+	for (int i = 0; i < 500; ++i)
+	{
+		b2Vec2 start(-1.f, i * .04f);
+		b2Vec2 end(20.f, 19.f - i * .03f);
+		RayQueryMode mode = static_cast<RayQueryMode>(i % 3);
+
+		parallel.AddRay(start, end, mode);
+		serial.AddRay(start, end, mode);
+	}
+
+	b2AABB aabb;
+	aabb.lowerBound.Set(-.1f, -.1f);
+	aabb.upperBound.Set(4.1f, 4.1f);
+	auto area = parallel.AddAABBQuery(aabb);
+	auto inside = parallel.AddPointTest(b2Vec2(2.f, 2.f));
+	auto outside = parallel.AddPointTest(b2Vec2(1.f, 1.f));
+
+	parallel.Execute(&world, pool);
+	serial.Execute(&world);
+
+	REQUIRE(parallel.GetRayHits().size() == serial.GetHits().size());
+
+	for (uint32_t ray = 0; ray < serial.GetRayCount(); ++ray)
+	{
+		REQUIRE(parallel.GetRayHitCount(ray) == serial.GetHitCount(ray));
+		REQUIRE(parallel.GetFirstRayHit(ray) == serial.GetFirstHit(ray));
+
+		for (uint32_t i = 0; i < serial.GetHitCount(ray); ++i)
+		{
+			const RayHit& a = parallel.GetRayHits()[parallel.GetFirstRayHit(ray) + i];
+			const RayHit& b = serial.GetHits()[serial.GetFirstHit(ray) + i];
+			REQUIRE(a.fixture == b.fixture);
+			REQUIRE(a.fraction == b.fraction);
+		}
+	}
+
+	REQUIRE(parallel.GetFixtureCount(area) == 9);
+	REQUIRE(parallel.GetFixtureCount(inside) == 1);
+	REQUIRE(parallel.GetFixtureCount(outside) == 0);
+}
\ No newline at end of file
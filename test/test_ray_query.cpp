@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/callbacks/ray_query.hpp"
+
+namespace
+{
+	/* Three boxes in a row along the x axis at x = 2, 4 and 6 */
+	void CreateRow(b2World& world)
+	{
+		for (int i = 1; i <= 3; ++i)
+		{
+			b2BodyDef def;
+			def.position.Set(2.f * i, 0.f);
+			b2Body* body = world.CreateBody(&def);
+
+			b2PolygonShape shape;
+			shape.SetAsBox(.5f, .5f);
+			body->CreateFixture(&shape, 0.f);
+		}
+	}
+}
+
+TEST_CASE("RayQueryBatch closest, any and all hits", "[rays]")
+{
+	b2World world(b2Vec2(0.f, 0.f));
+	CreateRow(world);
+
+	RayQueryBatch batch;
+	auto closest = batch.AddRay(b2Vec2(0.f, 0.f), b2Vec2(10.f, 0.f), RayQueryMode::Closest);
+	auto any = batch.AddRay(b2Vec2(0.f, 0.f), b2Vec2(10.f, 0.f), RayQueryMode::Any);
+	auto all = batch.AddRay(b2Vec2(0.f, 0.f), b2Vec2(10.f, 0.f), RayQueryMode::All);
+	auto miss = batch.AddRay(b2Vec2(0.f, 5.f), b2Vec2(10.f, 5.f), RayQueryMode::All);
+	auto empty = batch.AddRay(b2Vec2(1.f, 1.f), b2Vec2(1.f, 1.f));
+
+	batch.Execute(&world);
+
+	REQUIRE(batch.GetHitCount(closest) == 1);
+	REQUIRE(batch.GetClosestHit(closest)->point.x == Approx(1.5f));
+
+	REQUIRE(batch.GetHitCount(any) == 1);
+
+	REQUIRE(batch.GetHitCount(all) == 3);
+	const RayHit* hits = &batch.GetHits()[batch.GetFirstHit(all)];
+	REQUIRE(hits[0].point.x == Approx(1.5f));
+	REQUIRE(hits[1].point.x == Approx(3.5f));
+	REQUIRE(hits[2].point.x == Approx(5.5f));
+
+	REQUIRE(batch.GetClosestHit(miss) == nullptr);
+	REQUIRE(batch.GetHitCount(empty) == 0);
+}
+
+TEST_CASE("RayQueryBatch filters by category mask", "[rays]")
+{
+	b2World world(b2Vec2(0.f, 0.f));
+	CreateRow(world);
+
+	// Move the nearest box to another category
+	for (b2Body* body = world.GetBodyList(); body; body = body->GetNext())
+	{
+		if (body->GetPosition().x < 3.f)
+		{
+			b2Filter filter;
+			filter.categoryBits = 0x0002;
+			body->GetFixtureList()->SetFilterData(filter);
+		}
+	}
+
+	RayQueryBatch batch;
+	auto ray = batch.AddRay(b2Vec2(0.f, 0.f), b2Vec2(10.f, 0.f), RayQueryMode::Closest, 0x0001);
+	batch.Execute(&world);
+
+	REQUIRE(batch.GetClosestHit(ray)->point.x == Approx(3.5f));
+}
+
+TEST_CASE("RayQueryBatch keeps the nearest hits when a ray has too many", "[rays]")
+{
+	b2World world(b2Vec2(0.f, 0.f));
+
+	// More boxes than a ray keeps, created far to near so tree order
+	// does not match distance order
+	const int boxCount = RayQueryBatch::MAX_HITS_PER_RAY + 8;
+	for (int i = boxCount; i > 0; --i)
+	{
+		b2BodyDef def;
+		def.position.Set(2.f * i, 0.f);
+		b2Body* body = world.CreateBody(&def);
+
+		b2PolygonShape shape;
+		shape.SetAsBox(.5f, .5f);
+		body->CreateFixture(&shape, 0.f);
+	}
+
+	RayQueryBatch batch;
+	auto all = batch.AddRay(b2Vec2(0.f, 0.f), b2Vec2(2.f * boxCount + 2.f, 0.f), RayQueryMode::All);
+	batch.Execute(&world);
+
+	REQUIRE(batch.GetHitCount(all) == RayQueryBatch::MAX_HITS_PER_RAY);
+
+	const RayHit* hits = &batch.GetHits()[batch.GetFirstHit(all)];
+	for (std::uint32_t i = 0; i < RayQueryBatch::MAX_HITS_PER_RAY; ++i)
+		REQUIRE(hits[i].point.x == Approx(2.f * (i + 1) - .5f));
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include <catch2/catch.hpp>
+#include "box2d/box2d.h"
+
+#include "editor/constants.hpp"
+#include "editor/managers/sprite_manager.hpp"
+#include "editor/managers/trigger_zone_manager.hpp"
+
+namespace
+{
+	b2Body* CreateBall(b2World& world, const b2Vec2& position, std::uintptr_t owner)
+	{
+		b2BodyDef def;
+		def.type = b2_dynamicBody;
+		def.position = position;
+		def.userData.pointer = owner;
+		b2Body* body = world.CreateBody(&def);
+
+		b2CircleShape shape;
+		shape.m_radius = .25f;
+		body->CreateFixture(&shape, 1.f);
+		return body;
+	}
+
+	b2AABB MakeAABB(float x, float y, float w, float h)
+	{
+		b2AABB aabb;
+		aabb.lowerBound.Set(x, y);
+		aabb.upperBound.Set(x + w, y + h);
+		return aabb;
+	}
+}
+
+TEST_CASE("TriggerZoneManager reports enter, stay and exit", "[triggers]")
+{
+	b2World world(b2Vec2(0.f, 0.f));
+	TriggerZoneManager zones(&world);
+
+	int enters = 0, stays = 0, exits = 0;
+	ZoneHandle zone = zones.AddZone(MakeAABB(0.f, 0.f, 2.f, 2.f),
+		[&](TriggerEventType type, ZoneHandle, std::uintptr_t owner)
+		{
+			REQUIRE(owner == 7);
+			if (type == TriggerEventType::Enter) ++enters;
+			else if (type == TriggerEventType::Stay) ++stays;
+			else ++exits;
+		});
+
+	b2Body* ball = CreateBall(world, b2Vec2(1.f, 1.f), 7);
+
+	zones.Update();
+	zones.DispatchCallbacks();
+	REQUIRE(zones.GetEnterEvents().size() == 1);
+	REQUIRE(zones.GetEnterEvents()[0].zone == zone);
+
+	world.Step(1.f / 60.f, 8, 3);
+	zones.Update();
+	zones.DispatchCallbacks();
+	REQUIRE(zones.GetStayEvents().size() == 1);
+
+	ball->SetTransform(b2Vec2(10.f, 10.f), 0.f);
+	world.Step(1.f / 60.f, 8, 3);
+	zones.Update();
+	zones.DispatchCallbacks();
+	REQUIRE(zones.GetExitEvents().size() == 1);
+
+	REQUIRE(enters == 1);
+	REQUIRE(stays == 1);
+	REQUIRE(exits == 1);
+}
+
+TEST_CASE("TriggerZoneManager moves zones and rejects stale handles", "[triggers]")
+{
+	b2World world(b2Vec2(0.f, 0.f));
+	TriggerZoneManager zones(&world);
+
+	CreateBall(world, b2Vec2(5.f, 5.f), 1);
+
+	ZoneHandle a = zones.AddZone(MakeAABB(0.f, 0.f, 1.f, 1.f));
+	zones.Update();
+	REQUIRE(zones.GetEnterEvents().empty());
+
+	zones.MoveZone(a, MakeAABB(4.5f, 4.5f, 1.f, 1.f));
+	zones.Update();
+	REQUIRE(zones.GetEnterEvents().size() == 1);
+
+	// Removing a zone drops its overlaps without exit events
+	zones.RemoveZone(a);
+	REQUIRE_FALSE(zones.IsValid(a));
+	zones.Update();
+	REQUIRE(zones.GetExitEvents().empty());
+
+	// The slot is reused under a new generation, so the old handle
+	// cannot reach the new zone
+	ZoneHandle b = zones.AddZone(MakeAABB(0.f, 0.f, 1.f, 1.f));
+	REQUIRE(b.index == a.index);
+	REQUIRE(b.generation != a.generation);
+	REQUIRE(zones.IsValid(b));
+	REQUIRE_FALSE(zones.IsValid(a));
+
+	zones.MoveZone(a, MakeAABB(4.5f, 4.5f, 1.f, 1.f));
+	zones.RemoveZone(a);
+	REQUIRE(zones.IsValid(b));
+	REQUIRE(zones.GetZoneAABB(b).lowerBound.x == 0.f);
+	REQUIRE(zones.GetZoneCount() == 1);
+
+	// Clearing also leaves old handles stale
+	zones.Clear();
+	ZoneHandle c = zones.AddZone(MakeAABB(0.f, 0.f, 1.f, 1.f));
+	REQUIRE_FALSE(zones.IsValid(b));
+	REQUIRE(zones.IsValid(c));
+}
+
+TEST_CASE("TriggerZoneManager keeps overlaps when shapes change slot", "[triggers]")
+{
+	EditorSettings::levelSize = sf::Vector2u(1000, 1000);
+
+	// Removing the first box moves the box inside the zone into its slot,
+	// which changes its packed owner but not its overlaps
+	for (bool asleep : { false, true })
+	{
+		b2World world(b2Vec2(0.f, 0.f));
+		SpriteManager sprites(&world);
+		TriggerZoneManager zones(&world);
+
+		sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(100.f, 100.f));
+		sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(400.f, 100.f));
+
+		b2Body* leaving = nullptr;
+		b2Body* inside = nullptr;
+		for (b2Body* body = world.GetBodyList(); body; body = body->GetNext())
+			(body->GetPosition().x < 300.f / SCALE ? leaving : inside) = body;
+
+		REQUIRE(sprites.GetShape(inside)->GetIndex() == 1);
+
+		zones.AddZone(MakeAABB(300.f / SCALE, 0.f, 200.f / SCALE, 200.f / SCALE));
+		zones.Update();
+		REQUIRE(zones.GetEnterEvents().size() == 1);
+		REQUIRE(zones.GetEnterEvents()[0].owner == inside->GetUserData().pointer);
+
+		inside->SetAwake(!asleep);
+		leaving->SetTransform(b2Vec2(-100.f, 0.f), 0.f);
+		sprites.Update(1.f);
+
+		REQUIRE(sprites.GetShape(inside)->GetIndex() == 0);
+
+		zones.Update();
+		REQUIRE(zones.GetEnterEvents().empty());
+		REQUIRE(zones.GetExitEvents().empty());
+		REQUIRE(zones.GetStayEvents().size() == 1);
+		REQUIRE(zones.GetStayEvents()[0].owner == inside->GetUserData().pointer);
+
+		sprites.DestroyAllShapes();
+	}
+}
+
+TEST_CASE("TriggerZoneManager drops events of zones removed before dispatch", "[triggers]")
+{
+	b2World world(b2Vec2(0.f, 0.f));
+	TriggerZoneManager zones(&world);
+
+	CreateBall(world, b2Vec2(1.f, 1.f), 1);
+
+	int oldCalls = 0, newCalls = 0;
+	ZoneHandle a = zones.AddZone(MakeAABB(0.f, 0.f, 2.f, 2.f),
+		[&](TriggerEventType, ZoneHandle, std::uintptr_t) { ++oldCalls; });
+
+	zones.Update();
+	REQUIRE(zones.GetEnterEvents().size() == 1);
+
+	// Re-adding into the same slot must not receive the old zone's enter
+	zones.RemoveZone(a);
+	ZoneHandle b = zones.AddZone(MakeAABB(0.f, 0.f, 2.f, 2.f),
+		[&](TriggerEventType, ZoneHandle, std::uintptr_t) { ++newCalls; });
+	REQUIRE(b.index == a.index);
+	REQUIRE(zones.GetEnterEvents().empty());
+
+	zones.DispatchCallbacks();
+	REQUIRE(oldCalls == 0);
+	REQUIRE(newCalls == 0);
+}
+
+TEST_CASE("TriggerZoneManager reports a body replaced between updates", "[triggers]")
+{
+	EditorSettings::levelSize = sf::Vector2u(1000, 1000);
+
+	b2World world(b2Vec2(0.f, 0.f));
+	SpriteManager sprites(&world);
+	TriggerZoneManager zones(&world);
+
+	zones.AddZone(MakeAABB(300.f / SCALE, 0.f, 200.f / SCALE, 200.f / SCALE));
+
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(400.f, 100.f));
+	uintptr_t oldOwner = world.GetBodyList()->GetUserData().pointer;
+
+	zones.Update();
+	REQUIRE(zones.GetEnterEvents().size() == 1);
+
+	// Destroy the box and spawn another in its place. Box2D may hand the
+	// new body the old one's address, but the owner slot's generation moves.
+	world.GetBodyList()->SetTransform(b2Vec2(-100.f, 0.f), 0.f);
+	sprites.Update(1.f);
+	sprites.PushShape(ShapeType::DebugBox, sf::Vector2f(400.f, 100.f));
+	uintptr_t newOwner = world.GetBodyList()->GetUserData().pointer;
+	REQUIRE(newOwner != oldOwner);
+
+	zones.Update();
+	REQUIRE(zones.GetExitEvents().size() == 1);
+	REQUIRE(zones.GetExitEvents()[0].owner == oldOwner);
+	REQUIRE(zones.GetEnterEvents().size() == 1);
+	REQUIRE(zones.GetEnterEvents()[0].owner == newOwner);
+	REQUIRE(zones.GetStayEvents().empty());
+
+	sprites.DestroyAllShapes();
+}
\ No newline at end of file
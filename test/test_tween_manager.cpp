@@ -0,0 +1,98 @@
+#include <catch2/catch.hpp>
+
+#include "editor/managers/tween_manager.hpp"
+
+#include <vector>
+
+TEST_CASE("TweenManager finishes tweens and reuses their slots", "[tween]")
+{
+	auto tweens = TweenManager::GetInstance();
+	tweens->StopAll();
+
+	float value = 0.f;
+	TweenHandle handle = tweens->Spawn(&value, 0.f, 10.f, 1.f, InterpFunc::Linear);
+
+	REQUIRE(tweens->IsAnimating(handle));
+	REQUIRE(tweens->GetActiveCount() == 1);
+
+	tweens->Update(.5f);
+	REQUIRE(value == Approx(5.f));
+
+	tweens->Update(.5f);
+	REQUIRE(value == 10.f);
+	REQUIRE_FALSE(tweens->IsAnimating(handle));
+	REQUIRE(tweens->GetActiveCount() == 0);
+
+	// The freed slot is handed out again under a new generation
+	float other = 0.f;
+	TweenHandle reused = tweens->Spawn(&other, 0.f, 1.f, 1.f, InterpFunc::Linear);
+
+	REQUIRE(reused.index == handle.index);
+	REQUIRE(reused.generation != handle.generation);
+	REQUIRE_FALSE(tweens->IsAnimating(handle));
+
+	// Stopping through a stale handle must not touch the new tween
+	tweens->Stop(handle);
+	REQUIRE(tweens->IsAnimating(reused));
+
+	tweens->Stop(reused);
+	REQUIRE_FALSE(reused.IsValid());
+	REQUIRE(tweens->GetActiveCount() == 0);
+}
+
+TEST_CASE("TweenManager snaps to the target when the pool is full", "[tween]")
+{
+	auto tweens = TweenManager::GetInstance();
+	tweens->StopAll();
+
+	std::vector<float> values(TweenManager::MAX_TWEENS, 0.f);
+	for (auto& value : values)
+		tweens->Spawn(&value, 0.f, 1.f, 1.f, InterpFunc::Linear);
+
+	float overflow = 0.f;
+	TweenHandle handle = tweens->Spawn(&overflow, 0.f, 3.f, 1.f, InterpFunc::Linear);
+
+	REQUIRE_FALSE(handle.IsValid());
+	REQUIRE(overflow == 3.f);
+
+	tweens->StopAll();
+	REQUIRE(tweens->GetActiveCount() == 0);
+}
+
+TEST_CASE("TweenManager evaluates from lookup tables when enabled", "[tween]")
+{
+	auto tweens = TweenManager::GetInstance();
+	tweens->StopAll();
+	tweens->UseLookupTables();
+
+	REQUIRE(tweens->UsingLookupTables());
+	REQUIRE(tweens->GetLookupTableMemory() > 0);
+
+	float value = 0.f;
+	tweens->Spawn(&value, 0.f, 10.f, 1.f, InterpFunc::Linear);
+
+	tweens->Update(.25f);
+	REQUIRE(value == Approx(2.5f));
+
+	tweens->Update(1.f);
+	REQUIRE(value == 10.f);
+
+	tweens->UseLookupTables(0);
+	REQUIRE_FALSE(tweens->UsingLookupTables());
+}
+
+TEST_CASE("TweenManager falls back to QuartEaseOut for unknown functions", "[tween]")
+{
+	auto tweens = TweenManager::GetInstance();
+	tweens->StopAll();
+
+	float unknown = 0.f;
+	float quart = 0.f;
+	tweens->Spawn(&unknown, 0.f, 10.f, 1.f, static_cast<InterpFunc>(1000));
+	tweens->Spawn(&quart, 0.f, 10.f, 1.f, InterpFunc::QuartEaseOut);
+
+	tweens->Update(.5f);
+	REQUIRE(unknown == quart);
+
+	tweens->StopAll();
+}
\ No newline at end of file